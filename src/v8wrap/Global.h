@@ -38,6 +38,21 @@ inline constexpr bool V8Wrap_RequireMinV8Version =
 static_assert(V8Wrap_RequireMinV8Version, "v8wrap requires at least V8 version 12.4");
 #endif
 
+// Engine 占用的 isolate 数据槽 (Isolate::SetData) 与 context 嵌入数据索引 (Context::SetAlignedPointerInEmbedderData)
+// 与嵌入方 (例如 Node、Chromium) 使用的槽位冲突时，可在编译选项中重新定义
+#ifndef V8WRAP_ISOLATE_DATA_SLOT
+#define V8WRAP_ISOLATE_DATA_SLOT 3
+#endif
+
+#ifndef V8WRAP_CONTEXT_EMBEDDER_DATA_INDEX
+#define V8WRAP_CONTEXT_EMBEDDER_DATA_INDEX 48
+#endif
+
+// int64_t / uint64_t 的默认转换策略 (bind::Int64Mode 的枚举项名)，例如 -DV8WRAP_INT64_MODE=SafeNumber
+#ifndef V8WRAP_INT64_MODE
+#define V8WRAP_INT64_MODE BigInt
+#endif
+
 #if defined(_MSC_VER)
 #define V8_WRAP_WARNING_GUARD_BEGIN                                                                                    \
     __pragma(warning(push)) __pragma(warning(disable : 4100)) // unreferenced formal parameter
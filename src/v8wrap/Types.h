@@ -27,6 +27,7 @@ class ExitEngineScope;
 
 // 值类型
 enum class ValueType;
+enum class TypedArrayType;
 
 class Value;
 class Null;
@@ -39,6 +40,9 @@ class Symbol;
 class Function;
 class Object;
 class Array;
+class ArrayBuffer;
+class TypedArray;
+class DataView;
 
 class Arguments;
 
@@ -0,0 +1,60 @@
+#pragma once
+#include "v8wrap/Types.h"
+#include "v8wrap/bind/TypeConverter.h"
+#include "v8wrap/bind/meta/ClassDefine.h"
+#include "v8wrap/runtime/Engine.h"
+#include "v8wrap/runtime/EngineScope.h"
+#include "v8wrap/runtime/Exception.h"
+#include "v8wrap/types/Value.h"
+
+#include <string>
+
+
+namespace v8wrap::bind {
+
+
+/**
+ * 绑定类的 TypeConverter，以 Engine::isInstanceOf 判断 Js 值是否为 Define (或其子类) 的实例
+ * - toCpp 返回实例指针，绑定参数可声明为 T* / T& / T const&；实例已被销毁时抛出 TypeError
+ * - canConvert 对已销毁的实例返回 false，重载决议与 std::variant 不会选中它
+ * - toJs 以 newInstanceOfView 包装，不接管实例的生命周期
+ * @note Define 需具有静态存储期
+ * @code
+ * template <>
+ * struct bind::TypeConverter<Foo> : bind::ClassConverter<Foo, FooBind> {};
+ */
+template <typename T, meta::ClassDefine const& Define>
+struct ClassConverter {
+    static bool canConvert(Local<Value> const& value) { return instanceOf(value) && get(value) != nullptr; }
+
+    static Local<Value> toJs(T* value) {
+        if (value == nullptr) {
+            return Null::newNull();
+        }
+        return EngineScope::currentRuntimeChecked().newInstanceOfView(Define, value);
+    }
+
+    static T* toCpp(Local<Value> const& value) {
+        if (!instanceOf(value)) [[unlikely]] {
+            throw Exception{"expected an instance of " + std::string{Define.name_}, Exception::Type::TypeError};
+        }
+        auto instance = get(value);
+        if (instance == nullptr) [[unlikely]] {
+            throw Exception{"instance has been destroyed", Exception::Type::TypeError};
+        }
+        return instance;
+    }
+
+private:
+    static bool instanceOf(Local<Value> const& value) {
+        return value.isObject() && EngineScope::currentRuntimeChecked().isInstanceOf(value.asObject(), Define);
+    }
+
+    // 调用前需确认 value 为 Define 的实例
+    static T* get(Local<Value> const& value) {
+        return static_cast<T*>(Engine::getManagedResourceUnchecked(ValueHelper::unwrap(value.asObject()))->get());
+    }
+};
+
+
+} // namespace v8wrap::bind
@@ -0,0 +1,75 @@
+#pragma once
+#include "v8wrap/traits/FunctionTraits.h"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace v8wrap::bind {
+
+
+/**
+ * 带默认参数的函数 / 成员函数，由 withDefaults 创建
+ * defaults_ 依次对应最后 sizeof...(Defaults) 个参数，Js 调用时省略的尾部参数取默认值
+ * @note 可接受的参数个数与默认值的下标在编译期确定，调用时只按 args.length() 选择一条调用路径
+ */
+template <typename Func, typename... Defaults>
+struct DefaultArguments {
+    Func                    function_;
+    std::tuple<Defaults...> defaults_;
+};
+
+/**
+ * 为绑定的函数声明默认参数，可用于 Function::newFunction 与 ClassDefineBuilder 的 function / instanceMethod
+ * @code
+ * // std::string format(double value, int precision, std::string const& suffix);
+ * Function::newFunction(bind::withDefaults(&format, 2, std::string{"px"})); // format(1.5) / format(1.5, 0)
+ */
+template <typename Func, typename... Defaults>
+constexpr auto withDefaults(Func&& function, Defaults&&... defaults) {
+    using F     = std::decay_t<Func>;
+    using Tuple = typename traits::FunctionTraits<F>::ArgsTuple;
+
+    constexpr size_t N = std::tuple_size_v<Tuple>;
+    constexpr size_t D = sizeof...(Defaults);
+    static_assert(D <= N, "More default arguments than parameters");
+    static_assert(
+        []<size_t... I>(std::index_sequence<I...>) {
+            return (std::is_convertible_v<std::decay_t<Defaults> const&, std::tuple_element_t<N - D + I, Tuple>> && ...);
+        }(std::index_sequence_for<Defaults...>()),
+        "Default argument is not convertible to the corresponding parameter type"
+    );
+    return DefaultArguments<F, std::decay_t<Defaults>...>{
+        std::forward<Func>(function),
+        std::tuple<std::decay_t<Defaults>...>{std::forward<Defaults>(defaults)...}
+    };
+}
+
+
+namespace internal {
+
+template <typename T>
+struct IsDefaultArguments : std::false_type {};
+
+template <typename Func, typename... Defaults>
+struct IsDefaultArguments<DefaultArguments<Func, Defaults...>> : std::true_type {};
+
+// 成员函数指针，或包装成员函数指针的 DefaultArguments
+template <typename T>
+concept MemberFunctionLike =
+    std::is_member_function_pointer_v<T>
+    || (IsDefaultArguments<T>::value && std::is_member_function_pointer_v<decltype(T::function_)>);
+
+} // namespace internal
+
+
+} // namespace v8wrap::bind
+
+namespace v8wrap::traits {
+
+template <typename Func, typename... Defaults>
+struct FunctionTraits<bind::DefaultArguments<Func, Defaults...>> : FunctionTraits<Func> {};
+
+} // namespace v8wrap::traits
@@ -0,0 +1,219 @@
+#pragma once
+#include "v8wrap/Global.h"
+#include "v8wrap/Types.h"
+#include "v8wrap/bind/TypeConverter.h"
+#include "v8wrap/runtime/Exception.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace v8wrap::bind {
+
+namespace internal {
+
+/**
+ * 生产者线程与引擎线程之间的有界队列(与元素类型无关的部分)
+ * - 生产者线程：写入元素，队列满时阻塞或失败(背压)，结束时 close / fail
+ * - 引擎线程：Js 调用 next() 时批量取出并转换元素；队列为空时登记等待，由生产者向 Engine 投递任务唤醒
+ */
+class StreamChannel : public std::enable_shared_from_this<StreamChannel> {
+public:
+    V8WRAP_DISALLOW_COPY_AND_MOVE(StreamChannel);
+
+    enum class State { Open, Closed, Failed };
+
+    StreamChannel(size_t capacity, uint32_t batchSize)
+    : capacity_(capacity == 0 ? 1 : capacity),
+      batchSize_(batchSize == 0 ? 1 : batchSize) {}
+
+    virtual ~StreamChannel() = default;
+
+    // 同时唤醒阻塞在 push 中的其他生产者，它们会看到队列已关闭
+    void close() {
+        {
+            std::lock_guard lock{mutex_};
+            closed_ = true;
+            notifyReadable();
+        }
+        writable_.notify_all();
+    }
+
+    void fail(std::string message) {
+        {
+            std::lock_guard lock{mutex_};
+            if (!closed_) {
+                error_  = std::move(message);
+                failed_ = true;
+                closed_ = true;
+            }
+            notifyReadable();
+        }
+        writable_.notify_all();
+    }
+
+    [[nodiscard]] bool cancelled() const {
+        std::lock_guard lock{mutex_};
+        return cancelled_;
+    }
+
+    [[nodiscard]] uint32_t batchSize() const { return batchSize_; }
+
+    // 创建绑定到当前 Engine 的 Js 异步迭代器，每个队列只能创建一次
+    [[nodiscard]] Local<Object> newObject();
+
+    /**
+     * 取出至多 out.size() 个元素并转换 (引擎线程)
+     * @return 取出的个数；为 0 时 state 为队列状态，Open 表示已登记等待，有新元素或结束时会被唤醒
+     */
+    size_t take(std::span<Local<Value>> out, State& state, std::string& error);
+
+    // Js 侧结束迭代或迭代器被销毁，丢弃剩余元素并唤醒阻塞的生产者
+    void cancel();
+
+protected:
+    // 需持有锁；队列满时按 block 等待，返回 false 表示已取消或已关闭
+    bool waitWritable(std::unique_lock<std::mutex>& lock, bool block) {
+        if (block) {
+            writable_.wait(lock, [this] { return size_ < capacity_ || cancelled_ || closed_; });
+        }
+        return size_ < capacity_ && !cancelled_ && !closed_;
+    }
+
+    // 需持有锁
+    void notifyReadable();
+
+    // 需持有锁，将至多 max 个元素移出队列，暂存到 convertTaken 使用的缓冲中
+    virtual size_t takeLocked(size_t max) = 0;
+
+    // 不持有锁，转换 takeLocked 暂存的元素
+    virtual void convertTaken(std::span<Local<Value>> out) = 0;
+
+    // 需持有锁
+    virtual void clearLocked() = 0;
+
+    mutable std::mutex      mutex_;
+    std::condition_variable writable_;
+    size_t                  size_{0};
+    size_t const            capacity_;
+    uint32_t const          batchSize_;
+    bool                    closed_{false};
+    bool                    failed_{false};
+    bool                    cancelled_{false};
+    bool                    readerWaiting_{false};
+    std::string             error_;
+    Engine*                 engine_{nullptr}; // 绑定到 Js 后有效，取消后置空
+    void*                   reader_{nullptr}; // 仅在引擎线程访问
+};
+
+template <typename T>
+class StreamQueue final : public StreamChannel {
+public:
+    using StreamChannel::StreamChannel;
+
+    bool push(T&& value, bool block) {
+        std::unique_lock lock{mutex_};
+        if (!waitWritable(lock, block)) {
+            return false;
+        }
+        items_.push_back(std::move(value));
+        ++size_;
+        notifyReadable();
+        return true;
+    }
+
+protected:
+    size_t takeLocked(size_t max) override {
+        auto count = std::min(max, items_.size());
+        taken_.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            taken_.push_back(std::move(items_.front()));
+            items_.pop_front();
+        }
+        size_ -= count;
+        return count;
+    }
+
+    void convertTaken(std::span<Local<Value>> out) override {
+        auto items = std::move(taken_);
+        taken_.clear();
+        for (size_t i = 0; i < items.size(); ++i) {
+            out[i] = ConvertToJs(std::move(items[i]));
+        }
+    }
+
+    void clearLocked() override {
+        items_.clear();
+        size_ = 0;
+    }
+
+private:
+    std::deque<T>  items_;
+    std::vector<T> taken_; // 仅在引擎线程访问
+};
+
+} // namespace internal
+
+
+/**
+ * 将 C++ 生产者线程的数据以 Js 异步迭代器 (for await...of) 流式传递给 Js
+ * - 生产者与引擎线程之间是容量为 capacity 的有界队列：push 在队列满时阻塞，tryPush 立即返回 false(背压)
+ * - Js 每次取数据时一次性从队列中取出至多 batchSize 个元素并转换，之后的 next() 直接从已转换的批次中返回
+ * - Js 侧 break / return() 后队列被取消，push 返回 false，生产者应停止生产
+ * @note Stream 是共享句柄，可拷贝到生产者线程，生产者侧的函数均线程安全且不访问 V8
+ * @note 生产者唤醒 Js 依赖 Engine::postTask，嵌入方需在引擎线程中调用 Engine::runPendingTasks
+ * @code
+ * bind::Stream<std::string> lines{256};
+ * std::thread{[lines] { while (auto line = tail()) if (!lines.push(*line)) break; lines.close(); }}.detach();
+ * return lines;
+ */
+template <typename T>
+class Stream {
+public:
+    explicit Stream(size_t capacity = 1024, uint32_t batchSize = 64)
+    : queue_(std::make_shared<internal::StreamQueue<T>>(capacity, batchSize)) {}
+
+    // 队列满时阻塞等待，返回 false 表示 Js 侧已取消或队列已关闭
+    bool push(T value) const { return queue_->push(std::move(value), true); }
+
+    // 队列满时立即返回 false
+    bool tryPush(T value) const { return queue_->push(std::move(value), false); }
+
+    // 正常结束，Js 侧取完剩余元素后迭代结束
+    void close() const { queue_->close(); }
+
+    // 异常结束，Js 侧取完剩余元素后 next() 以 Error 拒绝
+    void fail(std::string message) const { queue_->fail(std::move(message)); }
+
+    [[nodiscard]] bool cancelled() const { return queue_->cancelled(); }
+
+    [[nodiscard]] std::shared_ptr<internal::StreamQueue<T>> const& queue() const { return queue_; }
+
+private:
+    std::shared_ptr<internal::StreamQueue<T>> queue_;
+};
+
+
+// Stream<T> -> AsyncIterator
+template <typename T>
+struct TypeConverter<Stream<T>> {
+    static Local<Object> toJs(Stream<T> const& value) { return value.queue()->newObject(); }
+
+    static bool canConvert(Local<Value> const& /* value */) { return false; }
+
+    static Stream<T> toCpp(Local<Value> const& /* value */) {
+        throw Exception{"Stream cannot be converted from Js", Exception::Type::TypeError};
+    }
+};
+
+
+} // namespace v8wrap::bind
@@ -1,22 +1,33 @@
 #pragma once
 #include "v8wrap/Types.h"
+#include "v8wrap/concepts/BasicConcepts.h"
 #include "v8wrap/traits/TypeTraits.h"
 
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <vector>
 
 
 namespace v8wrap::bind {
 
 
+/**
+ * Js 值与 C++ 类型 T 之间的转换器，特化需提供 toJs / toCpp
+ * 可选提供 static bool canConvert(Local<Value> const&)：不抛出异常地检查 Js 值能否转换为 T，
+ * 用于 std::variant / std::optional 选择候选类型与重载决议；未提供时视为总是可转换，由 toCpp 报告错误
+ * @note 主模板为空，以便 IsTypeConverterAvailable_v 在编译期探测是否存在特化；
+ *       缺少特化时由 ConvertToJs / ConvertToCpp 的静态断言报告
+ */
 template <typename T>
-struct TypeConverter {
-    static_assert(
-        sizeof(T) == 0,
-        "TypeConverter does not have a specialization for type T. Did you forget to specialize the template?"
-    );
-};
+struct TypeConverter {};
 
 template <typename T>
 concept HasTypeConverter = requires { typename TypeConverter<T>; };
@@ -40,6 +51,11 @@ concept TypeConverterAvailable = requires(Local<Value> const& v) {
 template <typename T>
 constexpr bool IsTypeConverterAvailable_v = TypeConverterAvailable<T>;
 
+template <typename T>
+concept HasCanConvert = requires(Local<Value> const& v) {
+    { RawTypeConverter<T>::canConvert(v) } -> std::convertible_to<bool>;
+};
+
 
 /**
  * @brief C++ 值类型转换器
@@ -58,16 +74,339 @@ struct CppValueTypeTransformer : std::false_type {};
 template <>
 struct CppValueTypeTransformer<std::string, std::string_view> : std::true_type {};
 
+template <>
+struct CppValueTypeTransformer<std::u16string, std::u16string_view> : std::true_type {};
+
 template <typename From, typename To>
 inline constexpr bool CppValueTypeTransformer_v = CppValueTypeTransformer<From, To>::value;
 
 
+/**
+ * 可直接映射到 TypedArray 元素的 C++ 类型
+ */
+template <typename T>
+concept TypedArrayElement =
+    (std::is_arithmetic_v<std::remove_cv_t<T>> && !std::same_as<std::remove_cv_t<T>, bool>
+     && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8))
+    || std::same_as<std::remove_cv_t<T>, std::byte>;
+
+
+/**
+ * 可直接与 v8 原始值互转的 C++ 类型 (bool 与映射为 Number 的算术类型)
+ * 参数转换直接读取 v8 值，返回值直接写入 v8::ReturnValue，不经过 Local 包装
+ */
+template <typename T>
+concept PrimitiveValue =
+    std::same_as<T, bool>
+    || (concepts::NumberLike<T> && !std::same_as<T, int64_t> && !std::same_as<T, uint64_t>);
+
+template <typename T>
+    requires PrimitiveValue<T>
+T PrimitiveToCpp(v8::Local<v8::Value> const& value);
+
+template <typename T>
+concept Int64Like = std::same_as<T, int64_t> || std::same_as<T, uint64_t>;
+
+// Number.MAX_SAFE_INTEGER (2^53 - 1)
+inline constexpr int64_t MaxSafeInteger = (int64_t{1} << 53) - 1;
+
+template <typename T>
+    requires Int64Like<T>
+constexpr bool IsSafeInteger(T value) {
+    if constexpr (std::is_signed_v<T>) {
+        return value >= -MaxSafeInteger && value <= MaxSafeInteger;
+    } else {
+        return value <= static_cast<uint64_t>(MaxSafeInteger);
+    }
+}
+
+/**
+ * 读取 64 位整数，接受 BigInt 与安全整数范围内的整数 Number，不丢失精度
+ * @throws Exception(RangeError) 非整数、超出安全整数范围的 Number 或超出 T 范围的 BigInt
+ */
+template <typename T>
+    requires Int64Like<T>
+T Int64ToCpp(v8::Local<v8::Value> const& value);
+
+
+} // namespace internal
+
+
+/**
+ * int64_t / uint64_t 转换为 Js 值的策略
+ * - BigInt: 始终为 BigInt
+ * - SafeNumber: 安全整数范围 (±(2^53 - 1)) 内为 Number，超出时为 BigInt
+ * - SafeNumberOrThrow: 安全整数范围内为 Number，超出时抛出 RangeError
+ * 转换为 C++ 时与策略无关，BigInt 与整数 Number 均可接受 (见 internal::Int64ToCpp)
+ * @note 全局默认策略由 V8WRAP_INT64_MODE 指定，单个绑定可使用 bind::Int64<T, Mode> 覆盖
+ */
+enum class Int64Mode {
+    BigInt,
+    SafeNumber,
+    SafeNumberOrThrow,
+};
+
+inline constexpr Int64Mode DefaultInt64Mode = Int64Mode::V8WRAP_INT64_MODE;
+
+/**
+ * 按指定策略转换的 64 位整数，用于单个绑定的参数或返回值
+ * @code Int64<uint64_t> id() const { return id_; }
+ */
+template <typename T, Int64Mode Mode = Int64Mode::SafeNumber>
+    requires internal::Int64Like<T>
+struct Int64 {
+    T value{};
+
+    constexpr Int64() = default;
+    constexpr Int64(T v) : value(v) {} // NOLINT(google-explicit-constructor)
+
+    constexpr operator T() const { return value; } // NOLINT(google-explicit-constructor)
+};
+
+
+/**
+ * C++ 内存暴露给 Js 时的生命周期策略
+ */
+enum class BufferLifetime {
+    Copy,   // 拷贝到 V8 管理的内存 (std::span 默认行为)
+    Borrow, // 直接引用 C++ 内存，调用方需保证其比所有 Js 引用活得更久
+};
+
+/**
+ * 以指定生命周期策略将连续内存转换为 TypedArray
+ * @code return BufferView<float, BufferLifetime::Borrow>{mesh.vertices()};
+ */
+template <typename T, BufferLifetime Lifetime = BufferLifetime::Copy>
+    requires internal::TypedArrayElement<T>
+struct BufferView {
+    std::span<T> span;
+};
+
+/**
+ * 将 C++ 缓冲区的所有权转移给 Js，转换为 TypedArray 时不拷贝，内存在 ArrayBuffer 被回收后释放
+ * @code return TransferBuffer<uint8_t>{std::move(packet)};
+ */
+template <typename T>
+    requires internal::TypedArrayElement<T>
+class TransferBuffer {
+public:
+    explicit TransferBuffer(std::vector<T>&& data) {
+        auto owner = std::make_shared<std::vector<T>>(std::move(data));
+        length_    = owner->size();
+        data_      = std::shared_ptr<T[]>(owner, owner->data()); // aliasing: keep the vector alive
+    }
+
+    TransferBuffer(std::unique_ptr<T[]>&& data, size_t length) : data_(std::move(data)), length_(length) {}
+
+    [[nodiscard]] std::shared_ptr<T[]> const& data() const { return data_; }
+
+    [[nodiscard]] size_t size() const { return length_; }
+
+private:
+    std::shared_ptr<T[]> data_;
+    size_t               length_{0};
+};
+
+
+/**
+ * 延迟转换视图：Js 对象持有 C++ 值，字段在首次读取时才转换，之后缓存为对象自身属性
+ * - 反射结构体(StructFields)：每个字段为惰性数据属性
+ * - std::unordered_map<std::string, V>：命名拦截器，未读取的键不产生任何转换
+ * @code return LazyView{std::move(config)};
+ */
+template <typename T>
+class LazyView {
+public:
+    explicit LazyView(T&& value) : value_(std::make_shared<T const>(std::move(value))) {}
+
+    explicit LazyView(std::shared_ptr<T const> value) : value_(std::move(value)) {}
+
+    [[nodiscard]] std::shared_ptr<T const> const& get() const { return value_; }
+
+private:
+    std::shared_ptr<T const> value_;
+};
+
+namespace internal {
+
+// 数组型容器：size() + operator[]，例如 std::vector / std::deque / std::array
+template <typename C>
+concept ArrayLikeContainer = requires(C& c, size_t i) {
+    typename C::value_type;
+    { c.size() } -> std::convertible_to<size_t>;
+    c[i];
+} && !requires { typename C::key_type; };
+
+// 字典型容器：字符串键 + find()，例如 std::unordered_map<std::string, V> / std::map<std::string, V>
+template <typename C>
+concept MapLikeContainer = requires(C& c, typename C::key_type const& key) {
+    typename C::mapped_type;
+    c.find(key) != c.end();
+} && concepts::StringLike<typename C::key_type>;
+
+template <typename C>
+concept LiveContainer = ArrayLikeContainer<std::remove_const_t<C>> || MapLikeContainer<std::remove_const_t<C>>;
+
+} // namespace internal
+
+/**
+ * 以引用方式将 C++ 容器暴露给 Js，读写直接作用于原容器，不进行整体拷贝
+ * - 数组型 (std::vector 等)：索引拦截器 + length，原型为 Array.prototype；写入 length 处时追加(需支持 push_back)
+ * - 字典型 (std::unordered_map<std::string, V> 等)：命名拦截器，支持读写、in、delete 与枚举
+ * @note 元素在每次读取时转换，容器为 const 时 Js 侧只读
+ * @note 调用方需保证容器比 Js 对象活得更久；通过 instancePropertyRef 绑定的容器成员会持有所属实例
+ * @code return ContainerRef{&registry.items()};
+ */
+template <typename Container>
+    requires internal::LiveContainer<Container>
+class ContainerRef {
+public:
+    explicit ContainerRef(Container* container) : container_(container) {}
+
+    [[nodiscard]] Container* get() const { return container_; }
+
+private:
+    Container* container_;
+};
+
+/**
+ * 以 Js 迭代器协议暴露任意 C++20 input_range，元素在 next() 时才从范围中取出并转换，不生成中间数组
+ * @note 返回的对象既是迭代器也是可迭代对象(同生成器对象)，只能遍历一次
+ * @note batchSize > 1 时每次从范围中连续取出并转换一批元素，暂存在 Js 数组中逐个返回
+ * @note 左值范围以 std::ranges::ref_view 引用(调用方需保证其生命周期)，右值范围由 Js 对象持有
+ * @code return Iterable{table.rows() | std::views::filter(isActive), 64};
+ */
+template <std::ranges::input_range R>
+class Iterable {
+public:
+    explicit Iterable(R range, uint32_t batchSize = 1)
+    : range_(std::make_shared<R>(std::move(range))),
+      batchSize_(batchSize == 0 ? 1 : batchSize) {}
+
+    [[nodiscard]] std::shared_ptr<R> const& range() const { return range_; }
+
+    [[nodiscard]] uint32_t batchSize() const { return batchSize_; }
+
+private:
+    std::shared_ptr<R> range_;
+    uint32_t           batchSize_;
+};
+
+template <typename R>
+Iterable(R&&, uint32_t = 1) -> Iterable<std::views::all_t<R>>;
+
+/**
+ * 结构体字段描述
+ * @see StructFields
+ */
+template <typename C, typename T>
+struct StructField {
+    std::string_view name;
+    T C::*           member;
+};
+
+#define V8WRAP_STRUCT_FIELD(TYPE, FIELD) ::v8wrap::bind::StructField{#FIELD, &TYPE::FIELD}
+
+/**
+ * 声明结构体的字段列表，声明后该结构体可直接与 Js Object 互相转换
+ * @note 每个 Engine 为结构体缓存一个 ObjectTemplate 与内部化的键，创建的对象共享同一形状(hidden class)
+ * @note 结构体需要可默认构造，且每个字段类型都有 TypeConverter
+ * @code
+ * template <>
+ * struct v8wrap::bind::StructFields<Point> {
+ *     static constexpr auto value = std::make_tuple(V8WRAP_STRUCT_FIELD(Point, x), V8WRAP_STRUCT_FIELD(Point, y));
+ * };
+ */
+template <typename T>
+struct StructFields;
+
+namespace internal {
+
+template <typename T>
+concept ReflectedStruct = std::is_class_v<T> && requires {
+    std::tuple_size<std::remove_cvref_t<decltype(StructFields<T>::value)>>::value;
+};
+
+/**
+ * 结构体对象形状缓存，按结构体类型分配槽位，数据存放在当前 Engine 中
+ */
+struct StructShapeCache {
+    static size_t nextSlot() noexcept;
+
+    // 以缓存的 ObjectTemplate 创建对象并按顺序写入字段
+    static Local<Object>
+    newObject(size_t slot, std::span<std::string_view const> names, std::span<Local<Value> const> values);
+
+    // 以缓存的键按顺序读取字段
+    static void readObject(
+        size_t                            slot,
+        std::span<std::string_view const> names,
+        Local<Object> const&              object,
+        std::span<Local<Value>>           values
+    );
+};
+
+/**
+ * LazyView 的类型擦除描述，每个被包装的类型一份(静态存储)，Engine 按其地址缓存 ObjectTemplate
+ */
+struct LazyObjectDefine {
+    // 反射结构体：字段名与按下标转换
+    std::span<std::string_view const> fields_{};
+    Local<Value> (*getField_)(void const* value, size_t index){nullptr};
+
+    // 键值容器：查找并转换(不存在时返回 false)、判断存在、枚举所有键
+    bool (*getEntry_)(void const* value, std::string_view key, Local<Value>& out){nullptr};
+    bool (*hasEntry_)(void const* value, std::string_view key){nullptr};
+    Local<Array> (*getKeys_)(void const* value){nullptr};
+
+    [[nodiscard]] Local<Object> newObject(std::shared_ptr<void const> value) const;
+};
+
+/**
+ * ContainerRef 的类型擦除描述，每个容器类型一份(静态存储)，Engine 按其地址缓存 ObjectTemplate
+ * @note 写入相关的函数为 nullptr 时 Js 侧只读
+ */
+struct LiveContainerDefine {
+    // 数组型
+    size_t (*size_)(void* container){nullptr};
+    Local<Value> (*getIndex_)(void* container, size_t index){nullptr};
+    void (*setIndex_)(void* container, size_t index, Local<Value> const& value){nullptr};
+    void (*append_)(void* container, Local<Value> const& value){nullptr};
+
+    // 字典型
+    bool (*getKey_)(void* container, std::string_view key, Local<Value>& out){nullptr};
+    bool (*hasKey_)(void* container, std::string_view key){nullptr};
+    void (*setKey_)(void* container, std::string_view key, Local<Value> const& value){nullptr};
+    bool (*deleteKey_)(void* container, std::string_view key){nullptr};
+    Local<Array> (*getKeys_)(void* container){nullptr};
+
+    [[nodiscard]] Local<Object> newObject(void* container, Local<Value> const& owner) const;
+};
+
+/**
+ * Iterable 的类型擦除描述，每个范围类型一份(静态存储)，所有迭代器共享 Engine 中的同一个类模板
+ */
+struct RangeIteratorDefine {
+    // 从范围中取出至多 out.size() 个元素并转换，返回取出的个数，少于 out.size() 表示已耗尽
+    size_t (*pull_)(void* state, std::span<Local<Value>> out){nullptr};
+    void (*destroy_)(void* state){nullptr};
+
+    [[nodiscard]] Local<Object> newObject(void* state, uint32_t batchSize) const;
+};
+
 } // namespace internal
 
 
 template <typename T>
 [[nodiscard]] inline Local<Value> ConvertToJs(T&& value);
 
+/**
+ * 检查 Js 值能否转换为 T，不抛出异常
+ * @note 只检查 Js 值的形状 (类型)，不检查容器元素，检查通过后的转换仍可能抛出异常
+ */
+template <typename T>
+[[nodiscard]] inline bool CanConvertToCpp(Local<Value> const& value);
+
 template <typename T>
 [[nodiscard]] inline decltype(auto) ConvertToCpp(Local<Value> const& value);
 
@@ -8,22 +8,200 @@
 #include "v8wrap/types/Value.h"
 
 
+#include <array>
+#include <cmath>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <variant>
+#include <vector>
 
 namespace v8wrap::bind {
 
+namespace adapter {
+// 由 CallbackAdapter.h 定义；以 CallbackAdapter.h 为入口包含时，此处先于其定义被解析
+template <typename R, typename... Args>
+inline decltype(auto) bindScriptCallback(Local<Value> const& value);
+} // namespace adapter
+
+namespace internal {
+
+template <typename T>
+    requires TypedArrayElement<T>
+constexpr TypedArrayType TypedArrayTypeOf() {
+    using U = std::remove_cv_t<T>;
+    if constexpr (std::is_floating_point_v<U>) {
+        return sizeof(U) == 4 ? TypedArrayType::Float32 : TypedArrayType::Float64;
+    } else if constexpr (sizeof(U) == 1) {
+        return std::is_signed_v<U> ? TypedArrayType::Int8 : TypedArrayType::Uint8;
+    } else if constexpr (sizeof(U) == 2) {
+        return std::is_signed_v<U> ? TypedArrayType::Int16 : TypedArrayType::Uint16;
+    } else if constexpr (sizeof(U) == 4) {
+        return std::is_signed_v<U> ? TypedArrayType::Int32 : TypedArrayType::Uint32;
+    } else {
+        return std::is_signed_v<U> ? TypedArrayType::BigInt64 : TypedArrayType::BigUint64;
+    }
+}
+
+/**
+ * 直接读取 v8 原始值，与 asBoolean().getValue() / asNumber().getDouble() 的语义一致
+ * 整数优先走 Int32 (Smi) 快速路径，避免经过 double 转换
+ */
+template <typename T>
+    requires PrimitiveValue<T>
+inline T PrimitiveToCpp(v8::Local<v8::Value> const& value) {
+    if constexpr (std::same_as<T, bool>) {
+        if (value->IsBoolean()) [[likely]] {
+            return value->IsTrue();
+        }
+        throw Exception("cannot convert to Boolean");
+    } else {
+        if constexpr (std::is_integral_v<T>) {
+            if (value->IsInt32()) [[likely]] {
+                return static_cast<T>(value.As<v8::Int32>()->Value());
+            }
+            if constexpr (std::is_unsigned_v<T> && sizeof(T) == sizeof(uint32_t)) {
+                if (value->IsUint32()) {
+                    return static_cast<T>(value.As<v8::Uint32>()->Value());
+                }
+            }
+        }
+        if (value->IsNumber()) [[likely]] {
+            return static_cast<T>(value.As<v8::Number>()->Value());
+        }
+        throw Exception("cannot convert to Number");
+    }
+}
+
+template <typename T>
+    requires Int64Like<T>
+inline T Int64ToCpp(v8::Local<v8::Value> const& value) {
+    if (value->IsInt32()) [[likely]] {
+        auto i = value.As<v8::Int32>()->Value();
+        if constexpr (std::is_unsigned_v<T>) {
+            if (i < 0) {
+                throw Exception("integer is out of range of uint64", Exception::Type::RangeError);
+            }
+        }
+        return static_cast<T>(i);
+    }
+    if (value->IsNumber()) {
+        auto d = value.As<v8::Number>()->Value();
+        // NaN 不满足任何比较，一并拒绝
+        if (!(d >= -static_cast<double>(MaxSafeInteger) && d <= static_cast<double>(MaxSafeInteger))
+            || std::trunc(d) != d) {
+            throw Exception("Number is not a safe integer", Exception::Type::RangeError);
+        }
+        if constexpr (std::is_unsigned_v<T>) {
+            if (d < 0) {
+                throw Exception("integer is out of range of uint64", Exception::Type::RangeError);
+            }
+        }
+        return static_cast<T>(d);
+    }
+    if (value->IsBigInt()) {
+        bool lossless = false;
+        T    result;
+        if constexpr (std::is_signed_v<T>) {
+            result = value.As<v8::BigInt>()->Int64Value(&lossless);
+        } else {
+            result = value.As<v8::BigInt>()->Uint64Value(&lossless);
+        }
+        if (!lossless) {
+            throw Exception(
+                std::is_signed_v<T> ? "BigInt is out of range of int64" : "BigInt is out of range of uint64",
+                Exception::Type::RangeError
+            );
+        }
+        return result;
+    }
+    throw Exception("cannot convert to BigInt or Number");
+}
+
+// 与 Int64ToCpp 一致：BigInt 或安全整数范围内的整数 Number (BigInt 的范围在转换时检查)
+template <typename T>
+    requires Int64Like<T>
+inline bool IsInt64Convertible(Local<Value> const& value) {
+    if (value.isBigInt()) {
+        return true;
+    }
+    if (!value.isNumber()) {
+        return false;
+    }
+    auto d = value.asNumber().getDouble();
+    if constexpr (std::is_unsigned_v<T>) {
+        if (d < 0) {
+            return false;
+        }
+    }
+    return std::trunc(d) == d && std::abs(d) <= static_cast<double>(MaxSafeInteger);
+}
+
+template <Int64Mode Mode, typename T>
+    requires Int64Like<T>
+inline auto Int64ToJs(T value) {
+    if constexpr (Mode == Int64Mode::BigInt) {
+        return BigInt::newBigInt(value);
+    } else {
+        if (IsSafeInteger(value)) [[likely]] {
+            return Number::newNumber(static_cast<double>(value)).asValue();
+        }
+        if constexpr (Mode == Int64Mode::SafeNumberOrThrow) {
+            throw Exception("integer is out of safe integer range", Exception::Type::RangeError);
+        } else {
+            return BigInt::newBigInt(value).asValue();
+        }
+    }
+}
+
+} // namespace internal
+
 // internal type
 template <typename T>
     requires concepts::JsValueType<T>
 struct TypeConverter<Local<T>> {
     static Local<Value> toJs(Local<T> const& value) { return value.asValue(); }
 
+    static bool canConvert(Local<Value> const& value) {
+        if constexpr (std::same_as<T, Value>) {
+            return true;
+        } else if constexpr (std::same_as<T, Null>) {
+            return value.isNull();
+        } else if constexpr (std::same_as<T, Undefined>) {
+            return value.isUndefined();
+        } else if constexpr (std::same_as<T, Boolean>) {
+            return value.isBoolean();
+        } else if constexpr (std::same_as<T, Number>) {
+            return value.isNumber();
+        } else if constexpr (std::same_as<T, BigInt>) {
+            return value.isBigInt();
+        } else if constexpr (std::same_as<T, String>) {
+            return value.isString();
+        } else if constexpr (std::same_as<T, Symbol>) {
+            return value.isSymbol();
+        } else if constexpr (std::same_as<T, Object>) {
+            return value.isObject();
+        } else if constexpr (std::same_as<T, Array>) {
+            return value.isArray();
+        } else if constexpr (std::same_as<T, ArrayBuffer>) {
+            return value.isArrayBuffer();
+        } else if constexpr (std::same_as<T, TypedArray>) {
+            return value.isTypedArray();
+        } else if constexpr (std::same_as<T, DataView>) {
+            return value.isDataView();
+        } else {
+            return value.isFunction();
+        }
+    }
+
     static Local<T> toCpp(Local<Value> const& value) { return value.as<T>(); }
 };
 
@@ -32,7 +210,9 @@ template <>
 struct TypeConverter<bool> {
     static Local<Boolean> toJs(bool value) { return Boolean::newBoolean(value); }
 
-    static bool toCpp(Local<Value> const& value) { return value.asBoolean().getValue(); }
+    static bool canConvert(Local<Value> const& value) { return value.isBoolean(); }
+
+    static bool toCpp(Local<Value> const& value) { return internal::PrimitiveToCpp<bool>(ValueHelper::unwrap(value)); }
 };
 
 // int/uint/float/double <-> Number
@@ -41,21 +221,31 @@ template <typename T>
 struct TypeConverter<T> {
     static Local<Number> toJs(T value) { return Number::newNumber(static_cast<double>(value)); }
 
-    static T toCpp(Local<Value> const& value) { return static_cast<T>(value.asNumber().getDouble()); }
+    static bool canConvert(Local<Value> const& value) { return value.isNumber(); }
+
+    static T toCpp(Local<Value> const& value) { return internal::PrimitiveToCpp<T>(ValueHelper::unwrap(value)); }
 };
 
-// int64/uint64 <-> BigInt
+// int64/uint64 <-> BigInt / Number，按 DefaultInt64Mode 转换
 template <typename T>
-    requires(std::same_as<T, int64_t> || std::same_as<T, uint64_t>)
+    requires internal::Int64Like<T>
 struct TypeConverter<T> {
-    static Local<BigInt> toJs(T value) { return BigInt::newBigInt(value); }
+    static auto toJs(T value) { return internal::Int64ToJs<DefaultInt64Mode>(value); }
 
-    static T toCpp(Local<Value> const& value) {
-        if constexpr (std::same_as<T, int64_t>) {
-            return value.asBigInt().getInt64();
-        } else {
-            return value.asBigInt().getUint64();
-        }
+    static bool canConvert(Local<Value> const& value) { return internal::IsInt64Convertible<T>(value); }
+
+    static T toCpp(Local<Value> const& value) { return internal::Int64ToCpp<T>(ValueHelper::unwrap(value)); }
+};
+
+// Int64<T, Mode> <-> BigInt / Number，按绑定指定的策略转换
+template <typename T, Int64Mode Mode>
+struct TypeConverter<Int64<T, Mode>> {
+    static auto toJs(Int64<T, Mode> value) { return internal::Int64ToJs<Mode>(value.value); }
+
+    static bool canConvert(Local<Value> const& value) { return internal::IsInt64Convertible<T>(value); }
+
+    static Int64<T, Mode> toCpp(Local<Value> const& value) {
+        return Int64<T, Mode>{internal::Int64ToCpp<T>(ValueHelper::unwrap(value))};
     }
 };
 
@@ -65,15 +255,37 @@ template <typename T>
 struct TypeConverter<T> {
     static Local<String> toJs(T const& value) { return String::newString(std::string_view{value}); }
 
+    // rvalue std::string: 交给 String 接管存储
+    template <typename S>
+        requires std::same_as<S, std::string>
+    static Local<String> toJs(S&& value) {
+        return String::newString(std::move(value));
+    }
+
+    static bool canConvert(Local<Value> const& value) { return value.isString(); }
+
     static std::string toCpp(Local<Value> const& value) { return value.asString().getValue(); } // always UTF-8
 };
 
+// std::u16string <-> String (UTF-16, 与 V8 内部表示一致，无需转码)
+template <typename T>
+    requires concepts::U16StringLike<T>
+struct TypeConverter<T> {
+    static Local<String> toJs(T const& value) { return String::newString(std::u16string_view{value}); }
+
+    static bool canConvert(Local<Value> const& value) { return value.isString(); }
+
+    static std::u16string toCpp(Local<Value> const& value) { return value.asString().getU16Value(); }
+};
+
 // enum -> Number (enum value)
 template <typename T>
     requires std::is_enum_v<T>
 struct TypeConverter<T> {
     static Local<Number> toJs(T value) { return Number::newNumber(static_cast<int>(value)); }
 
+    static bool canConvert(Local<Value> const& value) { return value.isNumber(); }
+
     static T toCpp(Local<Value> const& value) { return static_cast<T>(value.asNumber().getInt32()); }
 };
 
@@ -92,6 +304,8 @@ struct TypeConverter<std::function<R(Args...)>> {
         throw std::logic_error("UnSupported: cannot convert std::function to Value");
     }
 
+    static bool canConvert(Local<Value> const& value) { return value.isFunction(); }
+
     static std::function<R(Args...)> toCpp(Local<Value> const& value) {
         return adapter::bindScriptCallback<R, Args...>(value);
     }
@@ -107,8 +321,12 @@ struct TypeConverter<std::optional<T>> {
         return Null::newNull(); // default to null
     }
 
+    static bool canConvert(Local<Value> const& value) {
+        return value.isNullOrUndefined() || CanConvertToCpp<T>(value);
+    }
+
     static std::optional<T> toCpp(Local<Value> const& value) {
-        if (value.isUndefined() || value.isNull()) {
+        if (value.isNullOrUndefined()) {
             return std::nullopt;
         }
         return std::optional<T>{ConvertToCpp<T>(value)};
@@ -119,20 +337,24 @@ struct TypeConverter<std::optional<T>> {
 template <typename T>
 struct TypeConverter<std::vector<T>> {
     static Local<Value> toJs(std::vector<T> const& value) {
-        auto array = Array::newArray(value.size());
-        for (std::size_t i = 0; i < value.size(); ++i) {
-            array.set(i, ConvertToJs(value[i]));
+        // 先转换所有元素，再一次性创建数组
+        std::vector<Local<Value>> elements;
+        elements.reserve(value.size());
+        for (auto const& element : value) {
+            elements.push_back(ConvertToJs(element));
         }
-        return array;
+        return Array::newArray(elements);
     }
 
+    static bool canConvert(Local<Value> const& value) { return value.isArray(); }
+
     static std::vector<T> toCpp(Local<Value> const& value) {
-        auto array = value.asArray();
+        auto elements = value.asArray().toVector();
 
         std::vector<T> result;
-        result.reserve(array.length());
-        for (std::size_t i = 0; i < array.length(); ++i) {
-            result.push_back(ConvertToCpp<T>(array[i]));
+        result.reserve(elements.size());
+        for (auto const& element : elements) {
+            result.push_back(ConvertToCpp<T>(element));
         }
         return result;
     }
@@ -152,6 +374,8 @@ struct TypeConverter<std::unordered_map<K, V>> {
         return object;
     }
 
+    static bool canConvert(Local<Value> const& value) { return value.isObject(); }
+
     static std::unordered_map<K, V> toCpp(Local<Value> const& value) {
         auto object = value.asObject();
         auto keys   = object.getOwnPropertyNames();
@@ -164,6 +388,256 @@ struct TypeConverter<std::unordered_map<K, V>> {
     }
 };
 
+// reflected struct <-> Object
+template <typename T>
+    requires internal::ReflectedStruct<T>
+struct TypeConverter<T> {
+    static constexpr auto& fields = StructFields<T>::value;
+    static constexpr size_t N     = std::tuple_size_v<std::remove_cvref_t<decltype(fields)>>;
+
+    static constexpr auto names = []<size_t... I>(std::index_sequence<I...>) {
+        return std::array<std::string_view, N>{std::get<I>(fields).name...};
+    }(std::make_index_sequence<N>());
+
+    static size_t slot() {
+        static size_t const slot = internal::StructShapeCache::nextSlot();
+        return slot;
+    }
+
+    static Local<Object> toJs(T const& value) {
+        auto values = [&]<size_t... I>(std::index_sequence<I...>) {
+            return std::array<Local<Value>, N>{ConvertToJs(value.*(std::get<I>(fields).member))...};
+        }(std::make_index_sequence<N>());
+        return internal::StructShapeCache::newObject(slot(), names, values);
+    }
+
+    static bool canConvert(Local<Value> const& value) { return value.isObject(); }
+
+    static T toCpp(Local<Value> const& value) {
+        std::array<Local<Value>, N> values;
+        internal::StructShapeCache::readObject(slot(), names, value.asObject(), values);
+
+        T result{};
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            ((result.*(std::get<I>(fields).member) =
+                  ConvertToCpp<std::remove_cvref_t<decltype(result.*(std::get<I>(fields).member))>>(values[I])),
+             ...);
+        }(std::make_index_sequence<N>());
+        return result;
+    }
+};
+
+// LazyView<reflected struct> -> Object (惰性数据属性)
+template <typename T>
+    requires internal::ReflectedStruct<T>
+struct TypeConverter<LazyView<T>> {
+    static Local<Value> getField(void const* value, size_t index) {
+        auto const& fields = StructFields<T>::value;
+        auto const& object = *static_cast<T const*>(value);
+
+        Local<Value> result;
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (void)((index == I && (result = ConvertToJs(object.*(std::get<I>(fields).member)), true)) || ...);
+        }(std::make_index_sequence<TypeConverter<T>::N>());
+        return result;
+    }
+
+    static constexpr internal::LazyObjectDefine define{.fields_ = TypeConverter<T>::names, .getField_ = &getField};
+
+    static Local<Object> toJs(LazyView<T> const& view) { return define.newObject(view.get()); }
+
+    static bool canConvert(Local<Value> const& value) { return TypeConverter<T>::canConvert(value); }
+
+    static LazyView<T> toCpp(Local<Value> const& value) { return LazyView<T>{TypeConverter<T>::toCpp(value)}; }
+};
+
+// LazyView<std::unordered_map> -> Object (命名拦截器)
+template <typename K, typename V>
+    requires concepts::StringLike<K>
+struct TypeConverter<LazyView<std::unordered_map<K, V>>> {
+    using Map = std::unordered_map<K, V>;
+
+    static bool getEntry(void const* value, std::string_view key, Local<Value>& out) {
+        auto const& map  = *static_cast<Map const*>(value);
+        auto        iter = map.find(K{key});
+        if (iter == map.end()) {
+            return false;
+        }
+        out = ConvertToJs(iter->second);
+        return true;
+    }
+
+    static bool hasEntry(void const* value, std::string_view key) {
+        return static_cast<Map const*>(value)->contains(K{key});
+    }
+
+    static Local<Array> getKeys(void const* value) {
+        auto const& map = *static_cast<Map const*>(value);
+
+        std::vector<Local<Value>> keys;
+        keys.reserve(map.size());
+        for (auto const& [key, _] : map) {
+            keys.push_back(String::newString(std::string_view{key}));
+        }
+        return Array::newArray(keys);
+    }
+
+    static constexpr internal::LazyObjectDefine define{
+        .getEntry_ = &getEntry,
+        .hasEntry_ = &hasEntry,
+        .getKeys_  = &getKeys,
+    };
+
+    static Local<Object> toJs(LazyView<Map> const& view) { return define.newObject(view.get()); }
+
+    static bool canConvert(Local<Value> const& value) { return TypeConverter<Map>::canConvert(value); }
+
+    static LazyView<Map> toCpp(Local<Value> const& value) { return LazyView<Map>{TypeConverter<Map>::toCpp(value)}; }
+};
+
+// Iterable<R> -> Object (迭代器协议)
+template <typename R>
+struct TypeConverter<Iterable<R>> {
+    struct State {
+        std::shared_ptr<R>                         range;
+        std::optional<std::ranges::iterator_t<R>> iter; // 首次 next() 时才调用 begin()
+    };
+
+    static size_t pull(void* state, std::span<Local<Value>> out) {
+        auto& s = *static_cast<State*>(state);
+        if (!s.iter) {
+            s.iter.emplace(std::ranges::begin(*s.range));
+        }
+        auto& iter = *s.iter;
+        auto  end  = std::ranges::end(*s.range);
+
+        size_t count = 0;
+        for (; count < out.size() && iter != end; ++iter) {
+            out[count++] = ConvertToJs(*iter);
+        }
+        return count;
+    }
+
+    static constexpr internal::RangeIteratorDefine define{
+        .pull_    = &pull,
+        .destroy_ = [](void* state) { delete static_cast<State*>(state); },
+    };
+
+    static Local<Object> toJs(Iterable<R> const& value) {
+        return define.newObject(new State{value.range(), std::nullopt}, value.batchSize());
+    }
+
+    static bool canConvert(Local<Value> const& /* value */) { return false; }
+
+    static Iterable<R> toCpp(Local<Value> const& /* value */) {
+        throw Exception{"Iterable cannot be converted from Js", Exception::Type::TypeError};
+    }
+};
+
+// ContainerRef<数组型> -> Object (索引拦截器)
+template <typename Container>
+    requires internal::ArrayLikeContainer<std::remove_const_t<Container>>
+struct TypeConverter<ContainerRef<Container>> {
+    using C = std::remove_const_t<Container>;
+    using T = typename C::value_type;
+
+    static constexpr bool Writable = !std::is_const_v<Container> && std::is_assignable_v<typename C::reference, T>;
+
+    static C& ref(void* container) { return *static_cast<C*>(container); }
+
+    static size_t size(void* container) { return ref(container).size(); }
+
+    static Local<Value> getIndex(void* container, size_t index) { return ConvertToJs(ref(container)[index]); }
+
+    static void setIndex(void* container, size_t index, Local<Value> const& value) {
+        ref(container)[index] = ConvertToCpp<T>(value);
+    }
+
+    static void append(void* container, Local<Value> const& value) { ref(container).push_back(ConvertToCpp<T>(value)); }
+
+    static constexpr internal::LiveContainerDefine define = [] {
+        internal::LiveContainerDefine def{.size_ = &size, .getIndex_ = &getIndex};
+        if constexpr (Writable) {
+            def.setIndex_ = &setIndex;
+            if constexpr (requires(C& c, T&& v) { c.push_back(std::move(v)); }) {
+                def.append_ = &append;
+            }
+        }
+        return def;
+    }();
+
+    static Local<Object> toJs(ContainerRef<Container> const& value) {
+        return define.newObject(const_cast<C*>(value.get()), {});
+    }
+
+    static bool canConvert(Local<Value> const& /* value */) { return false; }
+
+    static ContainerRef<Container> toCpp(Local<Value> const& /* value */) {
+        throw Exception{"ContainerRef cannot be converted from Js", Exception::Type::TypeError};
+    }
+};
+
+// ContainerRef<字典型> -> Object (命名拦截器)
+template <typename Container>
+    requires internal::MapLikeContainer<std::remove_const_t<Container>>
+struct TypeConverter<ContainerRef<Container>> {
+    using C = std::remove_const_t<Container>;
+    using K = typename C::key_type;
+    using V = typename C::mapped_type;
+
+    static constexpr bool Writable = !std::is_const_v<Container>;
+
+    static C& ref(void* container) { return *static_cast<C*>(container); }
+
+    static bool getKey(void* container, std::string_view key, Local<Value>& out) {
+        auto& map  = ref(container);
+        auto  iter = map.find(K{key});
+        if (iter == map.end()) {
+            return false;
+        }
+        out = ConvertToJs(iter->second);
+        return true;
+    }
+
+    static bool hasKey(void* container, std::string_view key) { return ref(container).contains(K{key}); }
+
+    static void setKey(void* container, std::string_view key, Local<Value> const& value) {
+        ref(container).insert_or_assign(K{key}, ConvertToCpp<V>(value));
+    }
+
+    static bool deleteKey(void* container, std::string_view key) { return ref(container).erase(K{key}) > 0; }
+
+    static Local<Array> getKeys(void* container) {
+        auto& map = ref(container);
+
+        std::vector<Local<Value>> keys;
+        keys.reserve(map.size());
+        for (auto const& [key, _] : map) {
+            keys.push_back(String::newString(std::string_view{key}));
+        }
+        return Array::newArray(keys);
+    }
+
+    static constexpr internal::LiveContainerDefine define = [] {
+        internal::LiveContainerDefine def{.getKey_ = &getKey, .hasKey_ = &hasKey, .getKeys_ = &getKeys};
+        if constexpr (Writable) {
+            def.setKey_    = &setKey;
+            def.deleteKey_ = &deleteKey;
+        }
+        return def;
+    }();
+
+    static Local<Object> toJs(ContainerRef<Container> const& value) {
+        return define.newObject(const_cast<C*>(value.get()), {});
+    }
+
+    static bool canConvert(Local<Value> const& /* value */) { return false; }
+
+    static ContainerRef<Container> toCpp(Local<Value> const& /* value */) {
+        throw Exception{"ContainerRef cannot be converted from Js", Exception::Type::TypeError};
+    }
+};
+
 // std::variant <-> Type
 template <typename... Is>
 struct TypeConverter<std::variant<Is...>> {
@@ -180,10 +654,13 @@ struct TypeConverter<std::variant<Is...>> {
         return std::visit([&](auto const& v) -> Local<Value> { return ConvertToJs(v); }, value);
     }
 
-    static TypedVariant toCpp(Value const& value) { return tryToCpp(value); }
+    static bool canConvert(Local<Value> const& value) { return (CanConvertToCpp<Is>(value) || ...); }
+
+    // 按顺序选择 canConvert 通过的候选类型；只有通过检查后的转换仍然失败时才尝试下一个候选
+    static TypedVariant toCpp(Local<Value> const& value) { return tryToCpp(value); }
 
     template <size_t I = 0>
-    static TypedVariant tryToCpp(Value const& value) {
+    static TypedVariant tryToCpp(Local<Value> const& value) {
         if constexpr (I >= sizeof...(Is)) {
             throw Exception{
                 "Cannot convert Value to std::variant; no matching type found.",
@@ -191,11 +668,18 @@ struct TypeConverter<std::variant<Is...>> {
             };
         } else {
             using Type = std::variant_alternative_t<I, TypedVariant>;
-            try {
-                return ConvertToCpp<Type>(value);
-            } catch (Exception const&) {
+            if (!CanConvertToCpp<Type>(value)) {
                 return tryToCpp<I + 1>(value);
             }
+            if constexpr (I + 1 == sizeof...(Is)) {
+                return TypedVariant{std::in_place_index<I>, ConvertToCpp<Type>(value)};
+            } else {
+                try {
+                    return TypedVariant{std::in_place_index<I>, ConvertToCpp<Type>(value)};
+                } catch (Exception const&) {
+                    return tryToCpp<I + 1>(value);
+                }
+            }
         }
     }
 };
@@ -204,8 +688,10 @@ template <>
 struct TypeConverter<std::monostate> {
     static Local<Value> toJs(std::monostate) { return Null::newNull(); }
 
+    static bool canConvert(Local<Value> const& value) { return value.isNullOrUndefined(); }
+
     static std::monostate toCpp(Local<Value> const& value) {
-        if (value.isUndefined() || value.isNull()) {
+        if (value.isNullOrUndefined()) {
             return std::monostate{};
         }
         [[unlikely]] throw Exception{"Expected null/undefined for std::monostate", Exception::Type::TypeError};
@@ -224,8 +710,11 @@ struct TypeConverter<std::pair<Ty1, Ty2>> {
         array.set(1, ConvertToJs(pair.second));
         return array;
     }
+
+    static bool canConvert(Local<Value> const& value) { return value.isArray() && value.asArray().length() == 2; }
+
     static std::pair<Ty1, Ty2> toCpp(Local<Value> const& value) {
-        if (!value.isArray() || value.asArray().length() != 2) {
+        if (!canConvert(value)) {
             throw Exception{"Invalid argument type, expected array with 2 elements"};
         }
         auto array = value.asArray();
@@ -234,13 +723,112 @@ struct TypeConverter<std::pair<Ty1, Ty2>> {
 };
 
 
+// std::span <-> TypedArray
+// toCpp 直接借用 Js 的底层存储(零拷贝)，span 仅在 Js 对象存活且 ArrayBuffer 未分离期间有效
+// 单字节元素类型额外接受 ArrayBuffer / DataView / 任意 TypedArray，按原始字节访问
+template <typename T>
+    requires internal::TypedArrayElement<T>
+struct TypeConverter<std::span<T>> {
+    static Local<Value> toJs(std::span<T> const& value) { return ConvertToJs(BufferView<T>{value}); }
+
+    static bool canConvert(Local<Value> const& value) {
+        if (value.isTypedArray()) {
+            return sizeof(T) == 1 || value.asTypedArray().type() == internal::TypedArrayTypeOf<T>();
+        }
+        return sizeof(T) == 1 && (value.isArrayBuffer() || value.isDataView());
+    }
+
+    static std::span<T> toCpp(Local<Value> const& value) {
+        if (value.isTypedArray()) {
+            auto array = value.asTypedArray();
+            if constexpr (sizeof(T) == 1) {
+                return std::span<T>{static_cast<T*>(array.data()), array.byteLength()};
+            } else {
+                if (array.type() != internal::TypedArrayTypeOf<T>()) [[unlikely]] {
+                    throw Exception{"TypedArray element type mismatch", Exception::Type::TypeError};
+                }
+                return std::span<T>{static_cast<T*>(array.data()), array.length()};
+            }
+        }
+        if constexpr (sizeof(T) == 1) {
+            if (value.isArrayBuffer()) {
+                auto buffer = value.asArrayBuffer();
+                return std::span<T>{static_cast<T*>(buffer.data()), buffer.byteLength()};
+            }
+            if (value.isDataView()) {
+                auto view = value.asDataView();
+                return std::span<T>{static_cast<T*>(view.data()), view.byteLength()};
+            }
+        }
+        throw Exception{"expected TypedArray", Exception::Type::TypeError};
+    }
+};
+
+// BufferView -> TypedArray (按 BufferLifetime 拷贝或借用 C++ 内存)
+template <typename T, BufferLifetime Lifetime>
+struct TypeConverter<BufferView<T, Lifetime>> {
+    static Local<Value> toJs(BufferView<T, Lifetime> const& view) {
+        auto bytes = view.span.size_bytes();
+        auto data  = const_cast<void*>(static_cast<void const*>(view.span.data()));
+
+        Local<ArrayBuffer> buffer = Lifetime == BufferLifetime::Borrow ? ArrayBuffer::newExternal(data, bytes)
+                                                                       : ArrayBuffer::newArrayBuffer(data, bytes);
+        return TypedArray::newTypedArray(internal::TypedArrayTypeOf<T>(), buffer, 0, view.span.size());
+    }
+
+    static bool canConvert(Local<Value> const& value) { return TypeConverter<std::span<T>>::canConvert(value); }
+
+    static BufferView<T, Lifetime> toCpp(Local<Value> const& value) {
+        return BufferView<T, Lifetime>{TypeConverter<std::span<T>>::toCpp(value)};
+    }
+};
+
+// TransferBuffer -> TypedArray (Js 接管 C++ 内存的所有权)
+template <typename T>
+struct TypeConverter<TransferBuffer<T>> {
+    static Local<Value> toJs(TransferBuffer<T> const& value) {
+        auto holder = std::make_unique<std::shared_ptr<T[]>>(value.data());
+
+        auto buffer = ArrayBuffer::newExternal(
+            const_cast<std::remove_cv_t<T>*>(holder->get()),
+            value.size() * sizeof(T),
+            [](void*, size_t, void* deleterData) { delete static_cast<std::shared_ptr<T[]>*>(deleterData); },
+            holder.get()
+        );
+        (void)holder.release(); // owned by the BackingStore now
+        return TypedArray::newTypedArray(internal::TypedArrayTypeOf<T>(), buffer, 0, value.size());
+    }
+
+    static bool canConvert(Local<Value> const& value) { return TypeConverter<std::span<T>>::canConvert(value); }
+
+    static TransferBuffer<T> toCpp(Local<Value> const& value) {
+        auto span = TypeConverter<std::span<T>>::toCpp(value);
+        return TransferBuffer<T>{std::vector<T>(span.begin(), span.end())};
+    }
+};
+
+
 template <typename T>
 [[nodiscard]] inline Local<Value> ConvertToJs(T&& value) {
     static_assert(
         internal::IsTypeConverterAvailable_v<T>,
         "Cannot convert T to Js; there is no available TypeConverter."
     );
-    return internal::RawTypeConverter<T>::toJs(std::forward<T>(value)).asValue();
+    // 只在转换器能接受右值时移动，否则按左值传入 (例如用户转换器声明为 toJs(U&))
+    if constexpr (requires(std::remove_reference_t<T>& v) { internal::RawTypeConverter<T>::toJs(std::move(v)); }) {
+        return internal::RawTypeConverter<T>::toJs(std::forward<T>(value)).asValue();
+    } else {
+        return internal::RawTypeConverter<T>::toJs(value).asValue();
+    }
+}
+
+template <typename T>
+[[nodiscard]] inline bool CanConvertToCpp(Local<Value> const& value) {
+    if constexpr (internal::HasCanConvert<T>) {
+        return internal::RawTypeConverter<T>::canConvert(value);
+    } else {
+        return true;
+    }
 }
 
 template <typename T>
@@ -1,6 +1,22 @@
 #pragma once
+#include "v8wrap/bind/DefaultArguments.h"
 #include "v8wrap/bind/TypeConverter.h"
+#include "v8wrap/bind/adapter/InvokeHelper.h"
+#include "v8wrap/concepts/BasicConcepts.h"
+#include "v8wrap/concepts/ScriptConcepts.h"
+#include "v8wrap/runtime/Exception.h"
+#include "v8wrap/traits/FunctionTraits.h"
+#include "v8wrap/traits/TypeTraits.h"
 #include "v8wrap/types/Value.h"
+#include "v8wrap/types/internal/StringHelper.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace v8wrap::bind::adapter {
 
@@ -17,12 +33,128 @@ namespace v8wrap::bind::adapter {
 template <typename T>
 using ConvertReturnType = decltype(ConvertToCpp<T>(std::declval<Arguments const&>()[std::declval<size_t>()]));
 
+// 只读字符串参数(std::string_view / const char*)：借用调用期间的栈缓冲区，避免构造 std::string
+template <typename T>
+concept StringViewArgument =
+    std::same_as<std::remove_cvref_t<T>, std::string_view> || std::same_as<std::decay_t<T>, char const*>;
+
+template <bool NullTerminated>
+struct StringArgument : v8wrap::internal::Utf8ArgumentBuffer {
+    explicit StringArgument(Local<Value> const& value) : Utf8ArgumentBuffer(value, NullTerminated) {}
+
+    operator std::string_view() const noexcept { return view(); }
+    operator char const*() const noexcept
+        requires NullTerminated
+    {
+        return c_str();
+    }
+};
+
+template <typename T>
+struct TupleElement {
+    using type = std::conditional_t<
+        std::is_lvalue_reference_v<ConvertReturnType<T>>,
+        ConvertReturnType<T>,                     // 保持返回的引用类型（U& 或 const U&）
+        std::remove_cvref_t<ConvertReturnType<T>> // 否则按值存储
+        >;
+};
+
+template <typename T>
+    requires StringViewArgument<T>
+struct TupleElement<T> {
+    using type = StringArgument<std::same_as<std::decay_t<T>, char const*>>;
+};
+
+template <typename T>
+using TupleElementType = typename TupleElement<T>::type;
+
+// 直接读取 v8 参数，供原始类型的快速路径使用，跳过 Local<Value> 的构造
+struct RawArguments {
+    [[nodiscard]] static v8::Local<v8::Value> get(Arguments const& args, size_t index) {
+        return args.mArgs[static_cast<int>(index)];
+    }
+};
+
+// 按值传递的原始类型参数 (bool / int32 / double ...)
+template <typename T>
+concept PrimitiveArgument =
+    bind::internal::PrimitiveValue<std::remove_cvref_t<T>>
+    && (!std::is_reference_v<T> || std::is_const_v<std::remove_reference_t<T>>);
+
+// 64 位整数类型 (int64_t / uint64_t / Int64<T, Mode>) 的底层整数类型与转换策略
+template <typename T>
+struct Int64Type : std::false_type {};
+
 template <typename T>
-using TupleElementType = std::conditional_t<
-    std::is_lvalue_reference_v<ConvertReturnType<T>>,
-    ConvertReturnType<T>,                     // 保持返回的引用类型（U& 或 const U&）
-    std::remove_cvref_t<ConvertReturnType<T>> // 否则按值存储
-    >;
+    requires bind::internal::Int64Like<T>
+struct Int64Type<T> : std::true_type {
+    using type                      = T;
+    static constexpr Int64Mode mode = DefaultInt64Mode;
+};
+
+template <typename T, Int64Mode Mode>
+struct Int64Type<Int64<T, Mode>> : std::true_type {
+    using type                      = T;
+    static constexpr Int64Mode mode = Mode;
+};
+
+// 以 Number 策略 (SafeNumber / SafeNumberOrThrow) 转换的 64 位整数
+template <typename T>
+concept NumberInt64 = Int64Type<T>::value && Int64Type<T>::mode != Int64Mode::BigInt;
+
+// 按值传递的 64 位整数参数
+template <typename T>
+concept Int64Argument = Int64Type<std::remove_cvref_t<T>>::value
+                     && (!std::is_reference_v<T> || std::is_const_v<std::remove_reference_t<T>>);
+
+// 转换单个参数
+// - 原始类型直接读取 v8 值 (整数优先走 Int32 快速路径)
+// - 64 位整数直接读取 v8 值，接受 BigInt 与安全整数 Number
+// - 字符串参数直接传递 Js 值，由元组在原位构造 StringArgument
+template <typename T>
+inline decltype(auto) ConvertArgument(Arguments const& args, size_t index) {
+    if constexpr (PrimitiveArgument<T>) {
+        return bind::internal::PrimitiveToCpp<std::remove_cvref_t<T>>(RawArguments::get(args, index));
+    } else if constexpr (Int64Argument<T>) {
+        using U = std::remove_cvref_t<T>;
+        return U{bind::internal::Int64ToCpp<typename Int64Type<U>::type>(RawArguments::get(args, index))};
+    } else if constexpr (StringViewArgument<T>) {
+        return args[index];
+    } else {
+        return ConvertToCpp<T>(args[index]);
+    }
+}
+
+/**
+ * 将 C++ 返回值直接写入 v8::ReturnValue
+ * - 原始类型 (bool / 32 位以内整数 / 浮点) 直接写入原始值，int32 以 Smi 存放，不构造 Local
+ * - 以 Number 策略转换的 64 位整数在安全整数范围内直接写入 double
+ * - 其他类型经 ConvertToJs 转换
+ */
+template <typename T>
+inline void SetReturnValue(v8::ReturnValue<v8::Value> rv, T&& value) {
+    using U = std::remove_cvref_t<T>;
+    if constexpr (std::same_as<U, bool>) {
+        rv.Set(value);
+    } else if constexpr (bind::internal::PrimitiveValue<U> && std::is_integral_v<U> && sizeof(U) <= sizeof(int32_t)) {
+        if constexpr (std::is_signed_v<U>) {
+            rv.Set(static_cast<int32_t>(value));
+        } else {
+            rv.Set(static_cast<uint32_t>(value));
+        }
+    } else if constexpr (bind::internal::PrimitiveValue<U>) {
+        rv.Set(static_cast<double>(value));
+    } else if constexpr (NumberInt64<U>) {
+        auto integer = static_cast<typename Int64Type<U>::type>(value);
+        if (bind::internal::IsSafeInteger(integer)) [[likely]] {
+            rv.Set(static_cast<double>(integer));
+        } else {
+            rv.Set(ValueHelper::unwrap(ConvertToJs(std::forward<T>(value))));
+        }
+    } else {
+        rv.Set(ValueHelper::unwrap(ConvertToJs(std::forward<T>(value))));
+    }
+}
 
 // 转换参数类型
 template <typename Tuple, std::size_t... Is>
@@ -42,9 +174,45 @@ inline decltype(auto) ConvertArgsToTuple(Arguments const& args, std::index_seque
     // using ResultTuple = std::tuple<TupleElementType<std::tuple_element_t<Is, Tuple>>...>;
     // return ResultTuple(ConvertToCpp<std::tuple_element_t<Is, Tuple>>(args[Is])...);
 
+    // StringArgument 不可移动，依赖 C++17 的强制复制消除在调用方原位构造元组
     using ResultTuple = std::tuple<TupleElementType<std::tuple_element_t<Is, Tuple>>...>;
-    return ResultTuple(ConvertToCpp<std::tuple_element_t<Is, Tuple>>(args[Is])...);
+    return ResultTuple(ConvertArgument<std::tuple_element_t<Is, Tuple>>(args, Is)...);
+}
+
+
+
+namespace internal {
+
+/**
+ * 参数类型检查（不抛出异常），用于重载决议，由 TypeConverter::canConvert 提供
+ * @note 只检查 Js 值的形状(类型)，不检查容器元素；检查通过后的转换仍可能抛出异常
+ * @note 未提供 canConvert 的类型(用户自定义 TypeConverter)无法预先检查，一律视为匹配
+ */
+template <typename T>
+struct ArgumentMatcher {
+    static bool match(Local<Value> const& value) { return bind::CanConvertToCpp<T>(value); }
+};
+
+// BigInt 策略的 64 位整数参数只匹配 BigInt，整数 Number 留给 double 等重载 (转换时仍接受安全整数 Number)
+template <typename T>
+    requires(Int64Type<T>::value && !NumberInt64<T>)
+struct ArgumentMatcher<T> {
+    static bool match(Local<Value> const& value) { return value.isBigInt(); }
+};
+
+// 省略的尾部参数不检查 (调用前已保证参数个数在 [MinArity, Arity] 内)
+template <typename Tuple, std::size_t... Is>
+inline bool MatchArguments(Arguments const& args, std::index_sequence<Is...>) {
+    auto length = args.length();
+    return ((Is >= length || ArgumentMatcher<traits::RawType_t<std::tuple_element_t<Is, Tuple>>>::match(args[Is]))
+            && ...);
+}
+
+template <typename Tuple>
+bool MatchArgumentsOf(Arguments const& args) {
+    return MatchArguments<Tuple>(args, std::make_index_sequence<std::tuple_size_v<Tuple>>());
 }
 
+} // namespace internal
 
 } // namespace v8wrap::bind::adapter
\ No newline at end of file
@@ -1,37 +1,54 @@
 #pragma once
 #include "AdaptHelper.h"
 #include "v8wrap/Types.h"
+#include "v8wrap/bind/JsManagedResource.h"
+#include "v8wrap/bind/meta/ClassDefine.h"
 #include "v8wrap/concepts/BasicConcepts.h"
 #include "v8wrap/types/Value.h"
 
 namespace v8wrap::bind::adapter {
 
 
+// 参数个数不匹配时返回 nullptr
+template <typename C, typename... Args>
+void* constructInstance(Arguments const& args) {
+    constexpr size_t N = sizeof...(Args);
+    if constexpr (N == 0) {
+        static_assert(
+            concepts::HasDefaultConstructor<C>,
+            "Class C must have a no-argument constructor; otherwise, a constructor must be specified."
+        );
+        if (args.length() != 0) return nullptr; // Parameter mismatch
+        return new C();
+
+    } else {
+        if (args.length() != N) return nullptr; // Parameter mismatch
+
+        using Tuple = std::tuple<Args...>;
+
+        auto parameters = ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>());
+        return std::apply(
+            [](auto&&... unpackedArgs) { return new C(std::forward<decltype(unpackedArgs)>(unpackedArgs)...); },
+            std::move(parameters)
+        );
+    }
+}
+
 template <typename C, typename... Args>
 InstanceConstructor bindInstanceConstructor() {
-    return [](Arguments const& args) -> void* {
-        constexpr size_t N = sizeof...(Args);
-        if constexpr (N == 0) {
-            static_assert(
-                concepts::HasDefaultConstructor<C>,
-                "Class C must have a no-argument constructor; otherwise, a constructor must be specified."
-            );
-            if (args.length() != 0) return nullptr; // Parameter mismatch
-            return new C();
-
-        } else {
-            if (args.length() != N) return nullptr; // Parameter mismatch
-
-            using Tuple = std::tuple<Args...>;
-
-            auto parameters = ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>());
-            return std::apply(
-                [](auto&&... unpackedArgs) { return new C(std::forward<decltype(unpackedArgs)>(unpackedArgs)...); },
-                std::move(parameters)
-            );
-        }
-    };
+    return &constructInstance<C, Args...>;
 }
 
+// 包装 Js 构造的实例 (C*)，托管资源销毁时 delete 实例
+template <typename C>
+constexpr meta::ClassDefine::ManagedResourceFactory bindManagedResourceFactory() {
+    return [](void* instance) -> std::unique_ptr<JsManagedResource> {
+        return JsManagedResource::make(
+            instance,
+            [](void* res) -> void* { return res; },
+            [](void* res) -> void { delete static_cast<C*>(res); }
+        );
+    };
+}
 
 } // namespace v8wrap::bind::adapter
\ No newline at end of file
@@ -0,0 +1,156 @@
+#pragma once
+#include "v8wrap/bind/DefaultArguments.h"
+#include "v8wrap/bind/meta/MemberDefine.h"
+#include "v8wrap/runtime/Engine.h"
+#include "v8wrap/traits/FunctionTraits.h"
+
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
+V8_WRAP_WARNING_GUARD_BEGIN
+#include <v8-exception.h>
+#include <v8-external.h>
+#include <v8-fast-api-calls.h>
+#include <v8-isolate.h>
+#include <v8-local-handle.h>
+#include <v8-primitive.h>
+V8_WRAP_WARNING_GUARD_END
+
+namespace v8wrap::bind::adapter {
+
+namespace internal {
+
+// V8 Fast API 能直接传递的原始类型，且与 TypeConverter 的转换语义一致
+// int64_t/uint64_t 在 TypeConverter 中映射为 BigInt，故不参与快速路径
+template <typename T>
+concept FastCallPrimitive =
+    std::same_as<T, bool> || std::same_as<T, int32_t> || std::same_as<T, uint32_t> || std::same_as<T, double>;
+
+template <typename Tuple>
+struct FastCallArgs : std::false_type {};
+
+template <typename... Args>
+struct FastCallArgs<std::tuple<Args...>> : std::bool_constant<(FastCallPrimitive<Args> && ...)> {};
+
+/**
+ * 可生成 Fast API 回调的 C++ 函数
+ * @note Fast API 回调中无法抛出异常到 Js，所以要求函数为 noexcept
+ * @note 快速路径中的函数不允许调用 Js 或创建 Js 值
+ * @note 带默认参数的函数 (DefaultArguments) 需按参数个数选择调用路径，不参与快速路径
+ */
+template <typename Func, typename Traits = traits::FunctionTraits<std::decay_t<Func>>>
+concept FastCallable = !bind::internal::IsDefaultArguments<std::decay_t<Func>>::value && Traits::IsNoexcept
+                    && (std::is_void_v<typename Traits::ReturnType> || FastCallPrimitive<typename Traits::ReturnType>)
+                    && FastCallArgs<typename Traits::ArgsTuple>::value;
+
+// 部分 V8 版本的 FastApiCallbackOptions 提供 fallback 字段，用于请求回退到慢速路径
+template <typename Options>
+concept FastCallFallback = requires(Options& options) { options.fallback = true; };
+
+// 移除了 fallback 的 V8 版本通过 FastApiCallbackOptions::isolate 在快速路径中抛出异常
+template <typename Options>
+concept FastCallThrow = requires(Options& options) { options.isolate->ThrowException(v8::Local<v8::Value>{}); };
+
+// 实例方法的快速路径需要能拒绝已销毁的接收者，两者皆不支持时不生成快速路径
+constexpr bool InstanceFastCallSupported =
+    FastCallFallback<v8::FastApiCallbackOptions> || FastCallThrow<v8::FastApiCallbackOptions>;
+
+// 接收者已被销毁：回退到慢速路径处理，或直接抛出 TypeError
+template <typename Options>
+inline void rejectDestroyedReceiver(Options& options) {
+    if constexpr (FastCallFallback<Options>) {
+        options.fallback = true;
+    } else {
+        auto            isolate = options.isolate;
+        v8::HandleScope scope{isolate};
+        isolate->ThrowException(
+            v8::Exception::TypeError(v8::String::NewFromUtf8Literal(isolate, "instance has been destroyed"))
+        );
+    }
+}
+
+template <typename Func, typename R, typename Tuple>
+struct StaticFastCall;
+
+template <typename Func, typename R, typename... Args>
+struct StaticFastCall<Func, R, std::tuple<Args...>> {
+    static R call(v8::Local<v8::Object> /* receiver */, Args... args, v8::FastApiCallbackOptions& options) {
+        auto def = static_cast<meta::StaticMemberDefine::Function const*>(options.data.As<v8::External>()->Value());
+        auto& f  = *static_cast<Func const*>(def->fastCallback_.data_);
+        return std::invoke(f, args...);
+    }
+};
+
+template <typename C, typename Func, typename R, typename Tuple>
+struct InstanceFastCall;
+
+template <typename C, typename Func, typename R, typename... Args>
+struct InstanceFastCall<C, Func, R, std::tuple<Args...>> {
+    static R call(v8::Local<v8::Object> receiver, Args... args, v8::FastApiCallbackOptions& options) {
+        auto def = static_cast<meta::InstanceMemberDefine::Method const*>(options.data.As<v8::External>()->Value());
+        auto f   = *static_cast<Func const*>(def->fastCallback_.data_);
+
+        auto thiz = static_cast<C*>(Engine::getManagedResourceUnchecked(receiver)->get());
+        if (thiz == nullptr) [[unlikely]] {
+            rejectDestroyedReceiver(options);
+            if constexpr (std::is_void_v<R>) {
+                return;
+            } else {
+                return R{};
+            }
+        }
+        return (thiz->*f)(args...);
+    }
+};
+
+} // namespace internal
+
+
+/**
+ * FastCallback 与其 data_ 指向的可调用对象的所有者
+ * @note FastCallback 不持有可调用对象，调用方需保证 owner_ 与成员定义同生命周期 (见 ClassDefineStorage::keep)
+ */
+struct FastCallbackBinding {
+    meta::FastCallback          callback_{};
+    std::shared_ptr<void const> owner_{nullptr};
+};
+
+/**
+ * 为静态函数生成 V8 Fast API 回调，不满足 FastCallable 时返回空回调
+ */
+template <typename Func>
+FastCallbackBinding bindStaticFastFunction(Func&& fn) {
+    if constexpr (internal::FastCallable<Func>) {
+        using Fn     = std::decay_t<Func>;
+        using Traits = traits::FunctionTraits<Fn>;
+        using Call   = internal::StaticFastCall<Fn, typename Traits::ReturnType, typename Traits::ArgsTuple>;
+        auto owner   = std::make_shared<Fn const>(std::forward<Func>(fn));
+        return FastCallbackBinding{meta::FastCallback{v8::CFunction::Make(&Call::call), owner.get()}, owner};
+    } else {
+        return {};
+    }
+}
+
+/**
+ * 为实例方法生成 V8 Fast API 回调，不满足 FastCallable 时返回空回调
+ * @note 当前 V8 版本无法在快速路径中拒绝已销毁的接收者时 (见 InstanceFastCallSupported)，同样返回空回调
+ */
+template <typename C, typename Func>
+FastCallbackBinding bindInstanceFastMethod(Func&& fn) {
+    if constexpr (internal::InstanceFastCallSupported && std::is_member_function_pointer_v<std::decay_t<Func>>
+                  && internal::FastCallable<Func>) {
+        using Fn     = std::decay_t<Func>;
+        using Traits = traits::FunctionTraits<Fn>;
+        using Call   = internal::InstanceFastCall<C, Fn, typename Traits::ReturnType, typename Traits::ArgsTuple>;
+        auto owner   = std::make_shared<Fn const>(std::forward<Func>(fn));
+        return FastCallbackBinding{meta::FastCallback{v8::CFunction::Make(&Call::call), owner.get()}, owner};
+    } else {
+        return {};
+    }
+}
+
+
+} // namespace v8wrap::bind::adapter
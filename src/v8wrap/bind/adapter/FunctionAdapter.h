@@ -2,14 +2,34 @@
 #include "v8wrap/Types.h"
 #include "v8wrap/bind/TypeConverter.h"
 #include "v8wrap/bind/adapter/AdaptHelper.h"
+#include "v8wrap/bind/adapter/InvokeHelper.h"
 #include "v8wrap/concepts/ScriptConcepts.h"
 #include "v8wrap/traits/FunctionTraits.h"
 #include "v8wrap/types/Value.h"
 
 namespace v8wrap::bind::adapter {
 
-template <typename Tuple, std::size_t... Is>
-inline decltype(auto) ConvertArgsToTuple(Arguments const& args, std::index_sequence<Is...>);
+// 检查参数个数、转换参数并调用 C++ 函数，返回函数的原始结果；f 为编译期常量时 (见 Trampoline) 调用可被内联
+// 尾部的 std::optional 参数与默认参数 (见 withDefaults) 可省略
+template <typename Func>
+inline decltype(auto) invokeStaticFunction(Func const& f, Arguments const& args) {
+    using R = typename traits::FunctionTraits<std::decay_t<Func>>::ReturnType;
+    return InvokeWithArguments<R>(f, args, ArgumentsTraits<std::decay_t<Func>>::target(f));
+}
+
+// 转换参数并调用 C++ 函数，结果转换为 Js 值
+template <typename Func>
+inline Local<Value> callStaticFunction(Func const& f, Arguments const& args) {
+    using R = typename traits::FunctionTraits<std::decay_t<Func>>::ReturnType;
+
+    if constexpr (std::is_void_v<R>) {
+        invokeStaticFunction(f, args);
+        return {}; // undefined
+    } else {
+        decltype(auto) ret = invokeStaticFunction(f, args);
+        return ConvertToJs(std::forward<decltype(ret)>(ret)); // by-value results can be moved into Js
+    }
+}
 
 template <typename Func>
 FunctionCallback bindStaticFunction(Func&& func) {
@@ -17,44 +37,31 @@ FunctionCallback bindStaticFunction(Func&& func) {
         return std::forward<Func>(func);
     }
     return [f = std::forward<Func>(func)](Arguments const& args) -> Local<Value> {
-        using Traits       = traits::FunctionTraits<std::decay_t<Func>>;
-        using R            = typename Traits::ReturnType;
-        using Tuple        = typename Traits::ArgsTuple;
-        constexpr size_t N = std::tuple_size_v<Tuple>;
-
-        if (args.length() != N) [[unlikely]] {
-            throw Exception("argument count mismatch", Exception ::Type::TypeError);
-        }
-
-        if constexpr (std::is_void_v<R>) {
-            std::apply(f, ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>()));
-            return {}; // undefined
-        } else {
-            decltype(auto) ret = std::apply(f, ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>()));
-            return ConvertToJs(ret);
-        }
+        return callStaticFunction(f, args);
     };
 }
 
+template <typename Func>
+constexpr OverloadSignature bindStaticFunctionSignature() {
+    if constexpr (concepts::JsFunctionCallback<Func>) {
+        return OverloadSignature::any();
+    } else {
+        return OverloadSignature::ofTarget<std::decay_t<Func>>();
+    }
+}
+
 template <typename... Func>
 FunctionCallback bindStaticOverloadedFunction(Func&&... funcs) {
     std::vector functions = {bindStaticFunction(std::forward<Func>(funcs))...};
 
-    // TODO: consider optimizing overload dispatch (e.g. arg-count lookup)
-    // if we ever hit cases with >3 overloads. Current linear dispatch is ideal
-    // for small sets and keeps the common path fast.
-
-    return [fs = std::move(functions)](Arguments const& args) -> Local<Value> {
-        for (size_t i = 0; i < sizeof...(Func); ++i) {
-            try {
-                return std::invoke(fs[i], args);
-            } catch (Exception const&) {
-                if (i == sizeof...(Func) - 1) [[unlikely]] {
-                    throw Exception{"no overload found", Exception::Type::TypeError};
-                }
-            }
+    OverloadResolver resolver{{bindStaticFunctionSignature<Func>()...}};
+
+    return [fs = std::move(functions), resolver = std::move(resolver)](Arguments const& args) -> Local<Value> {
+        auto index = resolver.resolve(args);
+        if (index == OverloadResolver::npos) [[unlikely]] {
+            throw Exception{"no overload found", Exception::Type::TypeError};
         }
-        return {}; // undefined
+        return std::invoke(fs[index], args);
     };
 }
 
@@ -4,6 +4,8 @@
 #include "v8wrap/traits/TypeTraits.h"
 
 #include "v8wrap/bind/TypeConverter.h"
+#include "v8wrap/runtime/Engine.h"
+#include "v8wrap/runtime/Exception.h"
 
 namespace v8wrap::bind::adapter {
 
@@ -63,15 +65,25 @@ InstanceGetterCallback bindInstanceGetterRef(Fn&& fn, meta::ClassDefine const* d
 
         decltype(auto) result = std::invoke(f, static_cast<C*>(inst)); // const T* / T*
 
-        void* unk = nullptr;
-        if constexpr (std::is_const_v<Ret>) {
-            unk = const_cast<void*>(static_cast<const void*>(result));
+        using Pointee = std::remove_pointer_t<Ret>;
+        if constexpr (bind::internal::LiveContainer<Pointee>) {
+            // 容器成员：返回直接读写原容器的 Js 对象，并持有 this 防止其先被回收
+            return TypeConverter<ContainerRef<Pointee>>::define.newObject(
+                const_cast<std::remove_const_t<Pointee>*>(result),
+                arguments.thiz()
+            );
         } else {
-            unk = static_cast<void*>(result);
+            void* unk = nullptr;
+            if constexpr (std::is_const_v<Pointee>) {
+                unk = const_cast<void*>(static_cast<const void*>(result));
+            } else {
+                unk = static_cast<void*>(result);
+            }
+            if (def == nullptr) [[unlikely]] {
+                throw Exception{"Cannot reference class member; ClassDefine of the member type is required."};
+            }
+            return arguments.runtime()->newInstanceOfView(*def, unk, arguments.thiz());
         }
-        // TODO: fix
-        // return arguments.runtime()->newInstanceOfView(*def, unk, arguments.thiz());
-        return {};
     };
 }
 
@@ -81,6 +93,17 @@ bindInstancePropertyRef(Ty C::* member, meta::ClassDefine const* def) {
     using Raw = traits::RawType_t<Ty>;
     if constexpr (concepts::JsPrimitiveConvertible<Raw> && std::copyable<Raw>) {
         return bindInstanceProperty<C>(std::forward<Ty C::*>(member)); // Value type, can be copied directly
+    } else if constexpr (bind::internal::LiveContainer<Ty>) {
+        auto getter = bindInstanceGetterRef<C>([member](C* inst) -> Ty* { return &(inst->*member); }, def);
+        if constexpr (std::is_const_v<Ty> || !bind::internal::IsTypeConverterAvailable_v<Ty>) {
+            // 没有整体转换的容器 (std::deque / std::map 等) 只能通过返回的对象原地修改
+            return {std::move(getter), nullptr};
+        } else {
+            // 整体赋值时按值转换并替换原容器
+            return {std::move(getter), bindInstanceSetter<C>([member](C* inst, Ty val) -> void {
+                        inst->*member = std::move(val);
+                    })};
+        }
     } else {
         if constexpr (std::is_const_v<Ty>) {
             return {
@@ -88,10 +111,8 @@ bindInstancePropertyRef(Ty C::* member, meta::ClassDefine const* def) {
                 nullptr
             };
         } else {
-            return {
-                bindInstanceGetterRef<C>([member](C* inst) -> Ty* { return &(inst->*member); }, def),
-                bindInstanceSetter<C>([member](C* inst, Ty* val) -> void { inst->*member = *val; })
-            };
+            // 类类型成员没有可用的 TypeConverter<Ty*>，只能通过返回的实例原地修改
+            return {bindInstanceGetterRef<C>([member](C* inst) -> Ty* { return &(inst->*member); }, def), nullptr};
         }
     }
 }
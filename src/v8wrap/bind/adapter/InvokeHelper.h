@@ -0,0 +1,217 @@
+#pragma once
+#include "v8wrap/Types.h"
+#include "v8wrap/bind/DefaultArguments.h"
+#include "v8wrap/runtime/Exception.h"
+#include "v8wrap/traits/FunctionTraits.h"
+#include "v8wrap/types/Arguments.h"
+
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * 参数个数检查、调用分派与重载决议，不依赖 TypeConverter.h
+ * @note TypeConverter.h 经 Engine.h -> Value.inl 间接包含 FunctionAdapter.h，本文件中的声明须在此之前可用
+ */
+
+namespace v8wrap::bind::adapter {
+
+// 由 AdaptHelper.h 定义
+template <typename Tuple, std::size_t... Is>
+inline decltype(auto) ConvertArgsToTuple(Arguments const& args, std::index_sequence<Is...>);
+
+namespace internal {
+template <typename Tuple>
+bool MatchArgumentsOf(Arguments const& args);
+}
+
+template <typename T>
+struct IsOptionalArgument : std::false_type {};
+
+template <typename T>
+struct IsOptionalArgument<std::optional<T>> : std::true_type {};
+
+// 参数列表 [0, End) 中去掉尾部 std::optional 参数后的个数，尾部 optional 参数省略时转换自 undefined (std::nullopt)
+template <typename Tuple, size_t End = std::tuple_size_v<Tuple>>
+constexpr size_t RequiredArity() {
+    if constexpr (End == 0) {
+        return 0;
+    } else if constexpr (IsOptionalArgument<std::remove_cvref_t<std::tuple_element_t<End - 1, Tuple>>>::value) {
+        return RequiredArity<Tuple, End - 1>();
+    } else {
+        return End;
+    }
+}
+
+/**
+ * 绑定目标的参数信息，Js 调用时可接受的参数个数为 [MinArity, Arity]
+ * - 尾部的 std::optional 参数可省略
+ * - DefaultArguments 的最后 Defaults 个参数可省略，省略时取默认值
+ */
+template <typename Func>
+struct ArgumentsTraits {
+    using Target = Func;
+    using Tuple  = typename traits::FunctionTraits<Func>::ArgsTuple;
+
+    static constexpr size_t Arity    = std::tuple_size_v<Tuple>;
+    static constexpr size_t Defaults = 0;
+    static constexpr size_t MinArity = RequiredArity<Tuple>();
+
+    static constexpr Func const& target(Func const& f) { return f; }
+};
+
+template <typename Func, typename... Ds>
+struct ArgumentsTraits<DefaultArguments<Func, Ds...>> {
+    using Target = Func;
+    using Tuple  = typename traits::FunctionTraits<Func>::ArgsTuple;
+
+    static constexpr size_t Arity    = std::tuple_size_v<Tuple>;
+    static constexpr size_t Defaults = sizeof...(Ds);
+    static constexpr size_t MinArity = RequiredArity<Tuple, Arity - Defaults>();
+
+    static constexpr Func const& target(DefaultArguments<Func, Ds...> const& f) { return f.function_; }
+};
+
+template <size_t Offset, size_t... Is>
+constexpr std::index_sequence<Offset + Is...> OffsetIndexSequence(std::index_sequence<Is...>) {
+    return {};
+}
+
+// 转换前 K 个参数，其余参数取 defaults 中下标为 Ds 的默认值
+template <typename R, typename Tuple, typename Call, typename Defaults, size_t... Is, size_t... Ds>
+inline R CallWithDefaults(
+    Call const&      call,
+    Arguments const& args,
+    Defaults const&  defaults,
+    std::index_sequence<Is...>,
+    std::index_sequence<Ds...>
+) {
+    return std::apply(
+        [&](auto&&... converted) -> R {
+            return call(std::forward<decltype(converted)>(converted)..., std::get<Ds>(defaults)...);
+        },
+        ConvertArgsToTuple<Tuple>(args, std::index_sequence<Is...>())
+    );
+}
+
+// 按提供的参数个数选择调用路径，K 为转换的参数个数 (默认参数之前的参数总是转换)
+template <typename R, typename Tuple, size_t D, size_t K, typename Call, typename Defaults>
+inline R DispatchDefaults(Call const& call, Arguments const& args, Defaults const& defaults) {
+    constexpr size_t N     = std::tuple_size_v<Tuple>;
+    constexpr size_t First = N - D; // 第一个默认参数的下标
+
+    if constexpr (K < N) {
+        if (args.length() <= K) {
+            return CallWithDefaults<R, Tuple>(
+                call,
+                args,
+                defaults,
+                std::make_index_sequence<K>(),
+                OffsetIndexSequence<K - First>(std::make_index_sequence<N - K>())
+            );
+        }
+        return DispatchDefaults<R, Tuple, D, K + 1>(call, args, defaults);
+    } else {
+        return CallWithDefaults<R, Tuple>(call, args, defaults, std::make_index_sequence<N>(), std::index_sequence<>());
+    }
+}
+
+/**
+ * 检查参数个数、转换参数并以转换后的参数调用 call，省略的尾部参数按 ArgumentsTraits 补全
+ * @param f 绑定目标 (函数 / 成员函数或 DefaultArguments)，call 为实际调用 ArgumentsTraits::target(f) 的可调用对象
+ */
+template <typename R, typename Func, typename Call>
+inline R InvokeWithArguments(Func const& f, Arguments const& args, Call const& call) {
+    using AT    = ArgumentsTraits<std::decay_t<Func>>;
+    using Tuple = typename AT::Tuple;
+
+    auto length = args.length();
+    if (length < AT::MinArity || length > AT::Arity) [[unlikely]] {
+        throw Exception("argument count mismatch", Exception::Type::TypeError);
+    }
+    if constexpr (AT::Defaults == 0) {
+        return std::apply(call, ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<AT::Arity>()));
+    } else {
+        return DispatchDefaults<R, Tuple, AT::Defaults, AT::Arity - AT::Defaults>(call, args, f.defaults_);
+    }
+}
+
+
+/**
+ * 重载签名描述，由 C++ 函数签名在编译期生成
+ */
+struct OverloadSignature {
+    using Matcher = bool (*)(Arguments const& args);
+
+    size_t  arity_{0};
+    bool    variadic_{false};  // 原始回调(Arguments const&)，接受任意参数
+    Matcher matcher_{nullptr}; // 参数类型检查，调用前已保证 minArity_ <= args.length() <= arity_
+    size_t  minArity_{0};      // 尾部可省略参数 (std::optional / 默认参数) 之前的参数个数
+
+    template <typename Tuple, size_t MinArity = std::tuple_size_v<Tuple>>
+    static constexpr OverloadSignature of() {
+        return OverloadSignature{std::tuple_size_v<Tuple>, false, &internal::MatchArgumentsOf<Tuple>, MinArity};
+    }
+
+    // 绑定目标 (函数 / 成员函数或 DefaultArguments) 的签名
+    template <typename Func>
+    static constexpr OverloadSignature ofTarget() {
+        using AT = ArgumentsTraits<Func>;
+        return of<typename AT::Tuple, AT::MinArity>();
+    }
+
+    static constexpr OverloadSignature any() { return OverloadSignature{0, true, nullptr, 0}; }
+};
+
+/**
+ * 重载决议：先按参数个数分桶，再按声明顺序逐个检查参数类型，整个过程不抛出异常
+ * 可省略尾部参数的重载登记在 [minArity_, arity_] 的每个桶中
+ */
+class OverloadResolver {
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    explicit OverloadResolver(std::vector<OverloadSignature> const& signatures) {
+        for (size_t i = 0; i < signatures.size(); ++i) {
+            auto const& sig = signatures[i];
+            if (sig.variadic_) {
+                variadic_.push_back(i);
+                continue;
+            }
+            if (buckets_.size() <= sig.arity_) {
+                buckets_.resize(sig.arity_ + 1);
+            }
+            for (size_t arity = sig.minArity_; arity <= sig.arity_; ++arity) {
+                buckets_[arity].emplace_back(i, sig.matcher_);
+            }
+        }
+    }
+
+    /**
+     * @return 匹配的重载下标，无匹配时返回 npos
+     */
+    [[nodiscard]] size_t resolve(Arguments const& args) const {
+        // 保持声明顺序：先声明的原始回调优先于后声明的类型化重载
+        size_t const fallback = variadic_.empty() ? npos : variadic_.front();
+
+        auto argc = args.length();
+        if (argc < buckets_.size()) {
+            for (auto const& [index, matcher] : buckets_[argc]) {
+                if (index > fallback) break;
+                if (matcher(args)) {
+                    return index;
+                }
+            }
+        }
+        return fallback;
+    }
+
+private:
+    std::vector<std::vector<std::pair<size_t, OverloadSignature::Matcher>>> buckets_;  // arity -> candidates
+    std::vector<size_t>                                                      variadic_; // 接受任意参数的重载
+};
+
+} // namespace v8wrap::bind::adapter
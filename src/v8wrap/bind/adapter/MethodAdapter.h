@@ -1,5 +1,7 @@
 #pragma once
 #include "v8wrap/Types.h"
+#include "v8wrap/bind/adapter/AdaptHelper.h"
+#include "v8wrap/bind/adapter/InvokeHelper.h"
 #include "v8wrap/concepts/ScriptConcepts.h"
 #include "v8wrap/runtime/Exception.h"
 #include "v8wrap/traits/FunctionTraits.h"
@@ -10,68 +12,71 @@
 namespace v8wrap::bind::adapter {
 
 
+// 检查参数个数、转换参数并调用成员函数，返回函数的原始结果；f 为编译期常量时 (见 Trampoline) 调用可被内联
+// 尾部的 std::optional 参数与默认参数 (见 withDefaults) 可省略
 template <typename C, typename Func>
-InstanceMethodCallback bindInstanceMethod(Func&& fn) {
-    if constexpr (concepts::JsInstanceMethodCallback<std::remove_cvref_t<Func>>) {
-        return std::forward<Func>(fn); // 已是标准的回调，直接转发不需要进行绑定
-    }
-    return [f = std::forward<Func>(fn)](void* inst, const Arguments& args) -> Local<Value> {
-        using Traits       = traits::FunctionTraits<std::decay_t<Func>>;
-        using R            = typename Traits::ReturnType;
-        using Tuple        = typename Traits::ArgsTuple;
-        constexpr size_t N = std::tuple_size_v<Tuple>;
+inline decltype(auto) invokeInstanceMethod(Func const& f, void* inst, Arguments const& args) {
+    using R = typename traits::FunctionTraits<std::decay_t<Func>>::ReturnType;
 
-        if (args.length() != N) [[unlikely]] {
-            throw Exception("argument count mismatch", Exception::Type::TypeError);
-        }
+    auto  typedInstance = static_cast<C*>(inst);
+    auto& method        = ArgumentsTraits<std::decay_t<Func>>::target(f);
+    return InvokeWithArguments<R>(f, args, [typedInstance, &method](auto&&... unpackedArgs) -> R {
+        return (typedInstance->*method)(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
+    });
+}
 
-        auto typedInstance = static_cast<C*>(inst);
+// 转换参数并调用成员函数，结果转换为 Js 值
+template <typename C, typename Func>
+inline Local<Value> callInstanceMethod(Func const& f, void* inst, Arguments const& args) {
+    using R = typename traits::FunctionTraits<std::decay_t<Func>>::ReturnType;
 
-        if constexpr (std::is_void_v<R>) {
-            std::apply(
-                [typedInstance, &f](auto&&... unpackedArgs) {
-                    (typedInstance->*f)(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
-                },
-                ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>())
-            );
-            return {}; // undefined
+    if constexpr (std::is_void_v<R>) {
+        invokeInstanceMethod<C>(f, inst, args);
+        return {}; // undefined
+    } else {
+        decltype(auto) ret = invokeInstanceMethod<C>(f, inst, args);
+        // 特殊情况，对于 Builder 模式，返回 this
+        if constexpr (std::is_same_v<R, C&>) {
+            assert(args.hasThiz() && "this is required for Builder pattern");
+            return args.thiz();
         } else {
-            decltype(auto) ret = std::apply(
-                [typedInstance, &f](auto&&... unpackedArgs) -> R {
-                    return (typedInstance->*f)(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
-                },
-                ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>())
-            );
-            // 特殊情况，对于 Builder 模式，返回 this
-            if constexpr (std::is_same_v<R, C&>) {
-                assert(args.hasThiz() && "this is required for Builder pattern");
-                return args.thiz();
-            } else {
-                return ConvertToJs(ret);
-            }
+            return ConvertToJs(std::forward<decltype(ret)>(ret)); // by-value results can be moved into Js
         }
+    }
+}
+
+template <typename C, typename Func>
+InstanceMethodCallback bindInstanceMethod(Func&& fn) {
+    if constexpr (concepts::JsInstanceMethodCallback<std::remove_cvref_t<Func>>) {
+        return std::forward<Func>(fn); // 已是标准的回调，直接转发不需要进行绑定
+    }
+    return [f = std::forward<Func>(fn)](void* inst, const Arguments& args) -> Local<Value> {
+        return callInstanceMethod<C>(f, inst, args);
     };
 }
 
+template <typename Func>
+constexpr OverloadSignature bindInstanceMethodSignature() {
+    if constexpr (concepts::JsInstanceMethodCallback<std::remove_cvref_t<Func>>) {
+        return OverloadSignature::any();
+    } else {
+        return OverloadSignature::ofTarget<std::decay_t<Func>>();
+    }
+}
+
 template <typename C, typename... Func>
 InstanceMethodCallback bindInstanceOverloadedMethod(Func&&... funcs) {
     std::vector functions = {bindInstanceMethod<C>(std::forward<Func>(funcs))...};
 
-    // TODO: consider optimizing overload dispatch (e.g. arg-count lookup)
-    // if we ever hit cases with >3 overloads. Current linear dispatch is ideal
-    // for small sets and keeps the common path fast.
+    OverloadResolver resolver{{bindInstanceMethodSignature<Func>()...}};
 
-    return [fs = std::move(functions)](void* inst, Arguments const& args) -> Local<Value> {
-        for (size_t i = 0; i < sizeof...(Func); ++i) {
-            try {
-                return std::invoke(fs[i], inst, args);
-            } catch (Exception const&) {
-                if (i == sizeof...(Func) - 1) [[unlikely]] {
-                    throw Exception{"no overload found", Exception::Type::TypeError};
-                }
-            }
+    return [fs = std::move(functions), resolver = std::move(resolver)](void* inst, Arguments const& args)
+               -> Local<Value> {
+        auto index = resolver.resolve(args);
+        if (index == OverloadResolver::npos) [[unlikely]] {
+            throw Exception{"no overload found", Exception::Type::TypeError};
         }
-        return {}; // undefined
+        return std::invoke(fs[index], inst, args);
     };
 }
 
@@ -0,0 +1,179 @@
+#pragma once
+#include "v8wrap/bind/TypeConverter.h"
+#include "v8wrap/bind/adapter/AdaptHelper.h"
+#include "v8wrap/bind/adapter/ConstructorAdapter.h"
+#include "v8wrap/bind/adapter/FunctionAdapter.h"
+#include "v8wrap/bind/adapter/MethodAdapter.h"
+#include "v8wrap/bind/meta/MemberDefine.h"
+#include "v8wrap/runtime/Engine.h"
+#include "v8wrap/runtime/EngineScope.h"
+#include "v8wrap/runtime/Exception.h"
+#include "v8wrap/traits/TypeTraits.h"
+#include "v8wrap/types/Value.h"
+
+#include <type_traits>
+#include <utility>
+
+V8_WRAP_WARNING_GUARD_BEGIN
+#include <v8-function-callback.h>
+V8_WRAP_WARNING_GUARD_END
+
+namespace v8wrap::bind::adapter {
+
+/**
+ * 编译期生成的 V8 回调：函数/成员指针作为模板参数，每个绑定得到独立的 v8::FunctionCallback
+ * @note 调用时不经过成员定义查找与 std::function 的间接调用，参数转换与目标函数可被内联
+ * @note 原始类型的返回值直接写入 v8::ReturnValue (见 SetReturnValue)
+ * @note 语义与 bindStaticFunction / bindInstanceMethod / bindInstanceProperty 生成的回调一致
+ */
+struct Trampoline {
+    template <auto Fn>
+    static void staticFunction(v8::FunctionCallbackInfo<v8::Value> const& info) {
+        v8wrap::internal::CallbackScope scope{info.GetIsolate()};
+        try {
+            Arguments args{scope.runtime(), info};
+            if constexpr (std::is_void_v<decltype(invokeStaticFunction(Fn, args))>) {
+                invokeStaticFunction(Fn, args);
+            } else {
+                SetReturnValue(info.GetReturnValue(), invokeStaticFunction(Fn, args));
+            }
+        } catch (Exception const& e) {
+            e.rethrowToRuntime();
+        }
+    }
+
+    template <typename C, auto Method>
+    static void instanceMethod(v8::FunctionCallbackInfo<v8::Value> const& info) {
+        v8wrap::internal::CallbackScope scope{info.GetIsolate()};
+
+        auto thiz = (*Engine::getManagedResourceUnchecked(info.This()))(); // operator()()
+        if (thiz == nullptr) {
+            info.GetReturnValue().SetNull(); // object has been destroyed
+            return;
+        }
+        try {
+            Arguments args{scope.runtime(), info};
+            using R = decltype(invokeInstanceMethod<C>(Method, thiz, args));
+            if constexpr (std::is_void_v<R>) {
+                invokeInstanceMethod<C>(Method, thiz, args);
+            } else if constexpr (std::is_same_v<R, C&>) {
+                invokeInstanceMethod<C>(Method, thiz, args);
+                info.GetReturnValue().Set(info.This()); // Builder 模式，返回 this
+            } else {
+                SetReturnValue(info.GetReturnValue(), invokeInstanceMethod<C>(Method, thiz, args));
+            }
+        } catch (Exception const& e) {
+            e.rethrowToRuntime();
+        }
+    }
+
+    template <typename C, auto Member>
+    static void instanceGetter(v8::FunctionCallbackInfo<v8::Value> const& info) {
+        v8wrap::internal::CallbackScope scope{info.GetIsolate()};
+
+        auto thiz = static_cast<C*>((*Engine::getManagedResourceUnchecked(info.This()))());
+        if (thiz == nullptr) {
+            info.GetReturnValue().SetNull(); // object has been destroyed
+            return;
+        }
+        try {
+            SetReturnValue(info.GetReturnValue(), thiz->*Member);
+        } catch (Exception const& e) {
+            e.rethrowToRuntime();
+        }
+    }
+
+    template <typename C, auto Member>
+    static void instanceSetter(v8::FunctionCallbackInfo<v8::Value> const& info) {
+        using Ty = traits::MemberType_t<decltype(Member)>;
+
+        v8wrap::internal::CallbackScope scope{info.GetIsolate()};
+
+        auto thiz = static_cast<C*>((*Engine::getManagedResourceUnchecked(info.This()))());
+        if (thiz == nullptr) {
+            info.GetReturnValue().SetNull(); // object has been destroyed
+            return;
+        }
+        try {
+            Arguments args{scope.runtime(), info};
+            thiz->*Member = ConvertToCpp<Ty>(args[0]);
+        } catch (Exception const& e) {
+            e.rethrowToRuntime();
+        }
+    }
+};
+
+/**
+ * 编译期生成的 meta::CallbackRef 调用函数，供静态存储的类定义 (meta::ClassDefineTable) 使用
+ * @note 语义与对应的 bindXxx 生成的 std::function 一致，data 恒为空
+ */
+struct StaticInvoker {
+    template <auto Fn>
+    static Local<Value> staticFunction(void const* /* data */, Arguments const& args) {
+        return callStaticFunction(Fn, args);
+    }
+
+    template <auto Var>
+    static Local<Value> staticGetter(void const* /* data */) {
+        using Ty = std::remove_cv_t<std::remove_pointer_t<decltype(Var)>>;
+        return ConvertToJs(Ty{*Var}); // 静态属性按值传递，见 bindStaticProperty
+    }
+
+    template <auto Var>
+    static void staticSetter(void const* /* data */, Local<Value> const& value) {
+        *Var = ConvertToCpp<std::remove_pointer_t<decltype(Var)>>(value);
+    }
+
+    template <typename C, typename... Args>
+    static void* constructor(void const* /* data */, Arguments const& args) {
+        return constructInstance<C, Args...>(args);
+    }
+
+    template <auto Fn>
+    static void* customConstructor(void const* /* data */, Arguments const& args) {
+        return Fn(args);
+    }
+
+    static void* disabledConstructor(void const* /* data */, Arguments const& /* args */) { return nullptr; }
+
+    template <typename C, auto Method>
+    static Local<Value> instanceMethod(void const* /* data */, void* inst, Arguments const& args) {
+        return callInstanceMethod<C>(Method, inst, args);
+    }
+
+    template <typename C, auto Member>
+    static Local<Value> instanceGetter(void const* /* data */, void* inst, Arguments const& /* args */) {
+        return ConvertToJs(static_cast<C*>(inst)->*Member);
+    }
+
+    template <typename C, auto Member>
+    static void instanceSetter(void const* /* data */, void* inst, Arguments const& args) {
+        static_cast<C*>(inst)->*Member = ConvertToCpp<traits::MemberType_t<decltype(Member)>>(args[0]);
+    }
+};
+
+
+template <auto Fn>
+constexpr v8::FunctionCallback bindStaticTrampoline() {
+    return &Trampoline::staticFunction<Fn>;
+}
+
+template <typename C, auto Method>
+constexpr v8::FunctionCallback bindInstanceMethodTrampoline() {
+    return &Trampoline::instanceMethod<C, Method>;
+}
+
+/**
+ * @return {getter, setter}，const 成员没有 setter
+ */
+template <typename C, auto Member>
+constexpr std::pair<v8::FunctionCallback, v8::FunctionCallback> bindInstancePropertyTrampoline() {
+    if constexpr (std::is_const_v<traits::MemberType_t<decltype(Member)>>) {
+        return {&Trampoline::instanceGetter<C, Member>, nullptr};
+    } else {
+        return {&Trampoline::instanceGetter<C, Member>, &Trampoline::instanceSetter<C, Member>};
+    }
+}
+
+
+} // namespace v8wrap::bind::adapter
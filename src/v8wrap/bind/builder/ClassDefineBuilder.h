@@ -2,19 +2,25 @@
 #include "v8wrap/Types.h"
 #include "v8wrap/bind/adapter/ConstructorAdapter.h"
 #include "v8wrap/bind/adapter/EqualsAdapter.h"
+#include "v8wrap/bind/adapter/FastCallAdapter.h"
 #include "v8wrap/bind/adapter/FunctionAdapter.h"
 #include "v8wrap/bind/adapter/InstancePropertyAdapter.h"
 #include "v8wrap/bind/adapter/MethodAdapter.h"
 #include "v8wrap/bind/adapter/StaticPropertyAdapter.h"
+#include "v8wrap/bind/adapter/TrampolineAdapter.h"
 #include "v8wrap/bind/meta/ClassDefine.h"
 #include "v8wrap/bind/meta/MemberDefine.h"
 #include "v8wrap/concepts/ScriptConcepts.h"
 #include "v8wrap/traits/TypeTraits.h"
 
 #include <cstddef>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <vector>
 
 
 namespace v8wrap::bind {
@@ -29,52 +35,86 @@ enum class ConstructorState {
 template <typename Class, ConstructorState State = ConstructorState::None>
 struct ClassDefineBuilder {
 private:
-    std::string                                       className_;
-    std::vector<meta::StaticMemberDefine::Property>   staticProperty_;
-    std::vector<meta::StaticMemberDefine::Function>   staticFunctions_;
-    std::vector<meta::InstanceMemberDefine::Property> instanceProperty_;
-    std::vector<meta::InstanceMemberDefine::Method>   instanceFunctions_;
-    meta::ClassDefine const*                          base_ = nullptr;
+    // 名称、回调与成员表均存放在 storage_ 中，build() 后由 ClassDefine 持有
+    std::shared_ptr<meta::ClassDefineStorage> storage_ = std::make_shared<meta::ClassDefineStorage>();
+    std::string_view                          className_;
+    meta::ClassDefine const*                  base_ = nullptr;
 
-    InstanceConstructor                                          userDefinedConstructor_ = nullptr;
-    std::unordered_map<size_t, std::vector<InstanceConstructor>> constructors_           = {};
+    InstanceConstructor                     userDefinedConstructor_ = nullptr;
+    std::vector<InstanceConstructor>        constructors_           = {};
+    std::vector<adapter::OverloadSignature> constructorSignatures_  = {};
 
     static constexpr bool isInstanceClass = !std::is_void_v<Class>;
 
     template <ConstructorState OtherState>
     explicit ClassDefineBuilder(ClassDefineBuilder<Class, OtherState>&& other) noexcept
-    : className_(std::move(other.className_)),
-      staticProperty_(std::move(other.staticProperty_)),
-      staticFunctions_(std::move(other.staticFunctions_)),
-      instanceProperty_(std::move(other.instanceProperty_)),
-      instanceFunctions_(std::move(other.instanceFunctions_)),
+    : storage_(std::move(other.storage_)),
+      className_(other.className_),
       base_(other.base_),
       userDefinedConstructor_(std::move(other.userDefinedConstructor_)),
-      constructors_(std::move(other.constructors_)) {
+      constructors_(std::move(other.constructors_)),
+      constructorSignatures_(std::move(other.constructorSignatures_)) {
         // note: other may be in moved-from state
     }
 
     template <typename, ConstructorState>
     friend struct ClassDefineBuilder;
 
+    std::string_view name(std::string name) { return storage_->name(std::move(name)); }
+
+    template <typename Fn>
+    meta::CallbackRef<Fn> callback(Fn fn) {
+        return storage_->callback(std::move(fn));
+    }
+
+    meta::FastCallback fastCallback(adapter::FastCallbackBinding fast) {
+        storage_->keep(std::move(fast.owner_));
+        return fast.callback_;
+    }
+
 public:
-    explicit ClassDefineBuilder(std::string className) : className_(std::move(className)) {}
+    explicit ClassDefineBuilder(std::string className) : className_(storage_->name(std::move(className))) {}
 
     // 注册静态方法（已包装的 JsFunctionCallback） / Register static function (already wrapped)
     template <typename Fn>
     auto& function(std::string name, Fn&& fn)
         requires(concepts::JsFunctionCallback<Fn>)
     {
-        staticFunctions_.emplace_back(std::move(name), std::forward<Fn>(fn));
+        storage_->staticFunctions_.emplace_back(
+            this->name(std::move(name)),
+            callback(FunctionCallback{std::forward<Fn>(fn)})
+        );
         return *this;
     }
 
     // 注册静态方法（自动包装） / Register static function (wrap C++ callable)
+    // 对于 noexcept 且签名均为原始类型的函数，会额外生成 V8 Fast API 回调
+    // 尾部的 std::optional 参数可省略，默认参数使用 bind::withDefaults(fn, defaults...) 声明
     template <typename Fn>
     auto& function(std::string name, Fn&& fn)
         requires(!concepts::JsFunctionCallback<Fn>)
     {
-        staticFunctions_.emplace_back(std::move(name), adapter::bindStaticFunction(std::forward<Fn>(fn)));
+        auto fast = fastCallback(adapter::bindStaticFastFunction(fn));
+        storage_->staticFunctions_.emplace_back(
+            this->name(std::move(name)),
+            callback(adapter::bindStaticFunction(std::forward<Fn>(fn))),
+            fast
+        );
+        return *this;
+    }
+
+    // 注册静态方法（编译期绑定）/ Register static function as a template argument: function<&fn>("fn")
+    // 为此绑定生成专用的 v8::FunctionCallback，调用时不经过 std::function，参数转换与函数调用可被内联
+    template <auto Fn>
+    auto& function(std::string name)
+        requires(std::is_pointer_v<decltype(Fn)> && std::is_function_v<std::remove_pointer_t<decltype(Fn)>>)
+    {
+        storage_->staticFunctions_.emplace_back(
+            this->name(std::move(name)),
+            callback(adapter::bindStaticFunction(Fn)),
+            fastCallback(adapter::bindStaticFastFunction(Fn)),
+            adapter::bindStaticTrampoline<Fn>()
+        );
         return *this;
     }
 
@@ -83,13 +123,20 @@ public:
     auto& function(std::string name, Fn&&... fn)
         requires(sizeof...(Fn) > 1)
     {
-        staticFunctions_.emplace_back(std::move(name), adapter::bindStaticOverloadedFunction(std::forward<Fn>(fn)...));
+        storage_->staticFunctions_.emplace_back(
+            this->name(std::move(name)),
+            callback(adapter::bindStaticOverloadedFunction(std::forward<Fn>(fn)...))
+        );
         return *this;
     }
 
     // 注册静态属性（回调形式）/ Static property with raw callback
     auto& property(std::string name, GetterCallback getter, SetterCallback setter = nullptr) {
-        staticProperty_.emplace_back(std::move(name), std::move(getter), std::move(setter));
+        storage_->staticProperty_.emplace_back(
+            this->name(std::move(name)),
+            callback(std::move(getter)),
+            callback(std::move(setter))
+        );
         return *this;
     }
 
@@ -99,7 +146,11 @@ public:
     template <typename Ty>
     auto& property(std::string name, Ty* member) {
         auto gs = adapter::bindStaticProperty<Ty>(member);
-        staticProperty_.emplace_back(std::move(name), std::move(gs.first), std::move(gs.second));
+        storage_->staticProperty_.emplace_back(
+            this->name(std::move(name)),
+            callback(std::move(gs.first)),
+            callback(std::move(gs.second))
+        );
         return *this;
     }
 
@@ -118,8 +169,8 @@ public:
             !std::is_aggregate_v<Class> && std::is_constructible_v<Class, Args...>,
             "Constructor must be callable with the specified arguments"
         );
-        constexpr size_t N = sizeof...(Args);
-        constructors_[N].emplace_back(adapter::bindInstanceConstructor<Class, Args...>());
+        constructors_.emplace_back(adapter::bindInstanceConstructor<Class, Args...>());
+        constructorSignatures_.emplace_back(adapter::OverloadSignature::of<std::tuple<Args...>>());
 
         if constexpr (State == ConstructorState::Normal) {
             return *this; // 对于多构造重载(多次调用constructor)直接返回引用
@@ -164,27 +215,53 @@ public:
     auto& instanceMethod(std::string name, Fn&& fn)
         requires(isInstanceClass && concepts::JsInstanceMethodCallback<Fn>)
     {
-        instanceFunctions_.emplace_back(std::move(name), std::forward<Fn>(fn));
+        storage_->instanceMethods_.emplace_back(
+            this->name(std::move(name)),
+            callback(InstanceMethodCallback{std::forward<Fn>(fn)})
+        );
         return *this;
     }
 
     // 实例方法（自动包装）/ Instance method with automatic binding
+    // 对于 noexcept 且签名均为原始类型的方法，会额外生成 V8 Fast API 回调
+    // 尾部的 std::optional 参数可省略，默认参数使用 bind::withDefaults(&C::fn, defaults...) 声明
     template <typename Fn>
     auto& instanceMethod(std::string name, Fn&& fn)
-        requires(isInstanceClass && !concepts::JsInstanceMethodCallback<Fn> && std::is_member_function_pointer_v<Fn>)
+        requires(isInstanceClass && !concepts::JsInstanceMethodCallback<Fn>
+                 && internal::MemberFunctionLike<std::remove_cvref_t<Fn>>)
     {
-        instanceFunctions_.emplace_back(std::move(name), adapter::bindInstanceMethod<Class>(std::forward<Fn>(fn)));
+        auto fast = fastCallback(adapter::bindInstanceFastMethod<Class>(fn));
+        storage_->instanceMethods_.emplace_back(
+            this->name(std::move(name)),
+            callback(adapter::bindInstanceMethod<Class>(std::forward<Fn>(fn))),
+            fast
+        );
+        return *this;
+    }
+
+    // 实例方法（编译期绑定）/ Instance method as a template argument: instanceMethod<&C::fn>("fn")
+    // 为此绑定生成专用的 v8::FunctionCallback，调用时不经过 std::function，参数转换与方法调用可被内联
+    template <auto Method>
+    auto& instanceMethod(std::string name)
+        requires(isInstanceClass && std::is_member_function_pointer_v<decltype(Method)>)
+    {
+        storage_->instanceMethods_.emplace_back(
+            this->name(std::move(name)),
+            callback(adapter::bindInstanceMethod<Class>(Method)),
+            fastCallback(adapter::bindInstanceFastMethod<Class>(Method)),
+            adapter::bindInstanceMethodTrampoline<Class, Method>()
+        );
         return *this;
     }
 
     // 实例重载方法 / Overloaded instance methods
     template <typename... Fn>
     auto& instanceMethod(std::string name, Fn&&... fn)
-        requires(isInstanceClass && sizeof...(Fn) > 1 && (std::is_member_function_pointer_v<Fn> && ...))
+        requires(isInstanceClass && sizeof...(Fn) > 1 && (internal::MemberFunctionLike<std::remove_cvref_t<Fn>> && ...))
     {
-        instanceFunctions_.emplace_back(
-            std::move(name),
-            adapter::bindInstanceOverloadedMethod<Class>(std::forward<Fn>(fn)...)
+        storage_->instanceMethods_.emplace_back(
+            this->name(std::move(name)),
+            callback(adapter::bindInstanceOverloadedMethod<Class>(std::forward<Fn>(fn)...))
         );
         return *this;
     }
@@ -193,7 +270,11 @@ public:
     auto& instanceProperty(std::string name, InstanceGetterCallback getter, InstanceSetterCallback setter = nullptr)
         requires isInstanceClass
     {
-        instanceProperty_.emplace_back(std::move(name), std::move(getter), std::move(setter));
+        storage_->instanceProperty_.emplace_back(
+            this->name(std::move(name)),
+            callback(std::move(getter)),
+            callback(std::move(setter))
+        );
         return *this;
     }
 
@@ -204,7 +285,28 @@ public:
         requires(isInstanceClass && std::is_member_object_pointer_v<Member>)
     {
         auto gs = adapter::bindInstanceProperty<Class>(std::forward<Member>(member));
-        instanceProperty_.emplace_back(std::move(name), std::move(gs.first), std::move(gs.second));
+        storage_->instanceProperty_.emplace_back(
+            this->name(std::move(name)),
+            callback(std::move(gs.first)),
+            callback(std::move(gs.second))
+        );
+        return *this;
+    }
+
+    // 实例属性（成员变量，编译期绑定）/ Instance property as a template argument: instanceProperty<&C::member>("name")
+    template <auto Member>
+    auto& instanceProperty(std::string name)
+        requires(isInstanceClass && std::is_member_object_pointer_v<decltype(Member)>)
+    {
+        auto gs = adapter::bindInstanceProperty<Class>(Member);
+        auto tp = adapter::bindInstancePropertyTrampoline<Class, Member>();
+        storage_->instanceProperty_.emplace_back(
+            this->name(std::move(name)),
+            callback(std::move(gs.first)),
+            callback(std::move(gs.second)),
+            tp.first,
+            tp.second
+        );
         return *this;
     }
 
@@ -214,7 +316,27 @@ public:
         requires(isInstanceClass && std::is_member_object_pointer_v<Member>)
     {
         auto gs = adapter::bindInstancePropertyRef<Class>(std::forward<Member>(member), &def);
-        instanceProperty_.emplace_back(std::move(name), std::move(gs.first), std::move(gs.second));
+        storage_->instanceProperty_.emplace_back(
+            this->name(std::move(name)),
+            callback(std::move(gs.first)),
+            callback(std::move(gs.second))
+        );
+        return *this;
+    }
+
+    // 实例属性（容器成员，引用）/ Container member exposed by reference, see bind::ContainerRef
+    // 仅当容器本身有 TypeConverter (std::vector / std::unordered_map) 时支持整体赋值，否则属性只读
+    template <typename Member>
+    auto& instancePropertyRef(std::string name, Member member)
+        requires(isInstanceClass && std::is_member_object_pointer_v<Member>
+                 && internal::LiveContainer<traits::MemberType_t<Member>>)
+    {
+        auto gs = adapter::bindInstancePropertyRef<Class>(std::forward<Member>(member), nullptr);
+        storage_->instanceProperty_.emplace_back(
+            this->name(std::move(name)),
+            callback(std::move(gs.first)),
+            callback(std::move(gs.second))
+        );
         return *this;
     }
 
@@ -237,20 +359,15 @@ public:
                 ctor = std::move(userDefinedConstructor_);
             } else {
                 // Normal
-                ctor = [fn = std::move(constructors_)](Arguments const& arguments) -> void* {
-                    auto argc = arguments.length();
-                    auto iter = fn.find(argc);
-                    if (iter == fn.end()) {
+                adapter::OverloadResolver resolver{constructorSignatures_};
+                ctor = [fn = std::move(constructors_),
+                        resolver = std::move(resolver)](Arguments const& arguments) -> void* {
+                    auto index = resolver.resolve(arguments);
+                    if (index == adapter::OverloadResolver::npos) {
                         return nullptr;
                     }
-                    for (auto const& f : iter->second) {
-                        try {
-                            if (void* ptr = std::invoke(f, arguments)) {
-                                return ptr;
-                            }
-                        } catch (...) {}
-                    }
-                    return nullptr;
+                    // 签名已匹配，转换失败等异常直接抛给 Js
+                    return std::invoke(fn[index], arguments);
                 };
             }
         }
@@ -259,13 +376,7 @@ public:
         meta::ClassDefine::ManagedResourceFactory factory = nullptr;
         if constexpr (isInstanceClass) {
             if constexpr (State != ConstructorState::Disabled) {
-                factory = [](void* instance) -> std::unique_ptr<JsManagedResource> {
-                    return JsManagedResource::make(
-                        instance,
-                        [](void* res) -> void* { return res; },
-                        [](void* res) -> void { delete static_cast<Class*>(res); }
-                    );
-                };
+                factory = adapter::bindManagedResourceFactory<Class>();
             } // else: script cannot construct instances; do not provide factory (C++ owns lifetime)
         }
 
@@ -279,18 +390,20 @@ public:
         // TODO: fix RTTI typeid
         // constexpr auto   typeId = typeid(Class);
 
+        auto& storage = *storage_;
         return meta::ClassDefine{
-            std::move(className_),
-            meta::StaticMemberDefine{std::move(staticProperty_), std::move(staticFunctions_)},
+            className_,
+            meta::StaticMemberDefine{storage.staticProperty_, storage.staticFunctions_},
             meta::InstanceMemberDefine{
-                                     std::move(ctor),
-                                     std::move(instanceProperty_),
-                                     std::move(instanceFunctions_),
+                                     callback(std::move(ctor)),
+                                     storage.instanceProperty_,
+                                     storage.instanceMethods_,
                                      size, equals
             },
             base_,
             // std::move(typeId),
-            factory
+            factory,
+            std::move(storage_)
         };
     }
 };
@@ -0,0 +1,282 @@
+#pragma once
+#include "v8wrap/Types.h"
+#include "v8wrap/bind/adapter/ConstructorAdapter.h"
+#include "v8wrap/bind/adapter/EqualsAdapter.h"
+#include "v8wrap/bind/adapter/TrampolineAdapter.h"
+#include "v8wrap/bind/builder/ClassDefineBuilder.h"
+#include "v8wrap/bind/meta/ClassDefine.h"
+#include "v8wrap/bind/meta/MemberDefine.h"
+#include "v8wrap/traits/TypeTraits.h"
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+
+namespace v8wrap::bind {
+
+namespace internal {
+
+template <typename T, size_t N, size_t... I>
+constexpr std::array<T, N + 1> arrayAppend(std::array<T, N> const& array, T const& value, std::index_sequence<I...>) {
+    return {array[I]..., value};
+}
+
+template <typename T, size_t N>
+constexpr std::array<T, N + 1> arrayAppend(std::array<T, N> const& array, T const& value) {
+    return arrayAppend(array, value, std::make_index_sequence<N>());
+}
+
+} // namespace internal
+
+
+/**
+ * 编译期类定义构建器，生成静态存储的 meta::ClassDefineTable，meta::ClassDefine 直接引用其中的成员表
+ * - 成员以函数/成员指针作为模板参数绑定，回调均为编译期生成的函数 (Trampoline / StaticInvoker)，不创建 std::function
+ * - 名称为 string_view (通常是字符串字面量)，成员表为定长数组，注册时按顺序遍历
+ * - 每次添加成员返回新的构建器类型，整个链可在 constexpr 中求值，定义可常量初始化，启动时没有任何分配
+ * @note 不支持重载、Fast API 回调与运行时 lambda，需要时使用 ClassDefineBuilder
+ * @code
+ * constexpr auto FooTable = bind::defineClassTable<Foo>("Foo")
+ *                               .constructor<int>()
+ *                               .instanceMethod<&Foo::bar>("bar")
+ *                               .instanceProperty<&Foo::value_>("value")
+ *                               .build();
+ * constinit bind::meta::ClassDefine const FooBind{FooTable};
+ */
+template <
+    typename Class,
+    ConstructorState State = ConstructorState::None,
+    size_t NSP             = 0,
+    size_t NSF             = 0,
+    size_t NIP             = 0,
+    size_t NIM             = 0>
+class ClassDefineTableBuilder {
+public:
+    using Table = meta::ClassDefineTable<NSP, NSF, NIP, NIM>;
+
+private:
+    Table table_;
+
+    static constexpr bool isInstanceClass = !std::is_void_v<Class>;
+
+    template <typename, ConstructorState, size_t, size_t, size_t, size_t>
+    friend class ClassDefineTableBuilder;
+
+    constexpr explicit ClassDefineTableBuilder(Table const& table) : table_(table) {}
+
+    template <ConstructorState S, size_t SP, size_t SF, size_t IP, size_t IM>
+    static constexpr auto next(meta::ClassDefineTable<SP, SF, IP, IM> const& table) {
+        return ClassDefineTableBuilder<Class, S, SP, SF, IP, IM>{table};
+    }
+
+    constexpr auto addStaticProperty(meta::StaticMemberDefine::Property const& property) const {
+        auto& t = table_;
+        return next<State>(meta::ClassDefineTable<NSP + 1, NSF, NIP, NIM>{
+            t.name_,
+            internal::arrayAppend(t.staticProperty_, property),
+            t.staticFunctions_,
+            t.constructor_,
+            t.instanceProperty_,
+            t.instanceMethods_,
+            t.classSize_,
+            t.equals_,
+            t.base_,
+            t.factory_
+        });
+    }
+
+    constexpr auto addStaticFunction(meta::StaticMemberDefine::Function const& function) const {
+        auto& t = table_;
+        return next<State>(meta::ClassDefineTable<NSP, NSF + 1, NIP, NIM>{
+            t.name_,
+            t.staticProperty_,
+            internal::arrayAppend(t.staticFunctions_, function),
+            t.constructor_,
+            t.instanceProperty_,
+            t.instanceMethods_,
+            t.classSize_,
+            t.equals_,
+            t.base_,
+            t.factory_
+        });
+    }
+
+    constexpr auto addInstanceProperty(meta::InstanceMemberDefine::Property const& property) const {
+        auto& t = table_;
+        return next<State>(meta::ClassDefineTable<NSP, NSF, NIP + 1, NIM>{
+            t.name_,
+            t.staticProperty_,
+            t.staticFunctions_,
+            t.constructor_,
+            internal::arrayAppend(t.instanceProperty_, property),
+            t.instanceMethods_,
+            t.classSize_,
+            t.equals_,
+            t.base_,
+            t.factory_
+        });
+    }
+
+    constexpr auto addInstanceMethod(meta::InstanceMemberDefine::Method const& method) const {
+        auto& t = table_;
+        return next<State>(meta::ClassDefineTable<NSP, NSF, NIP, NIM + 1>{
+            t.name_,
+            t.staticProperty_,
+            t.staticFunctions_,
+            t.constructor_,
+            t.instanceProperty_,
+            internal::arrayAppend(t.instanceMethods_, method),
+            t.classSize_,
+            t.equals_,
+            t.base_,
+            t.factory_
+        });
+    }
+
+    template <ConstructorState S>
+    constexpr auto withConstructor(meta::CallbackRef<InstanceConstructor> constructor) const {
+        auto table         = table_;
+        table.constructor_ = constructor;
+        return next<S>(table);
+    }
+
+public:
+    constexpr explicit ClassDefineTableBuilder(std::string_view className)
+        requires(NSP == 0 && NSF == 0 && NIP == 0 && NIM == 0)
+    : table_{className, {}, {}, nullptr, {}, {}, traits::size_of_v<Class>, nullptr, nullptr, nullptr} {
+        if constexpr (isInstanceClass) {
+            table_.equals_ = adapter::bindInstanceEquals<Class>();
+        }
+    }
+
+    // 静态方法 / Static function: function<&fn>("fn")
+    template <auto Fn>
+    constexpr auto function(std::string_view name) const
+        requires(std::is_pointer_v<decltype(Fn)> && std::is_function_v<std::remove_pointer_t<decltype(Fn)>>)
+    {
+        return addStaticFunction(meta::StaticMemberDefine::Function{
+            name,
+            meta::CallbackRef<FunctionCallback>{&adapter::StaticInvoker::staticFunction<Fn>},
+            {},
+            adapter::bindStaticTrampoline<Fn>()
+        });
+    }
+
+    // 静态属性（变量指针）/ Static property: property<&variable>("name")，按值传递，const 变量只读
+    template <auto Var>
+    constexpr auto property(std::string_view name) const
+        requires(std::is_pointer_v<decltype(Var)> && std::is_object_v<std::remove_pointer_t<decltype(Var)>>)
+    {
+        meta::CallbackRef<SetterCallback> setter{};
+        if constexpr (!std::is_const_v<std::remove_pointer_t<decltype(Var)>>) {
+            setter = meta::CallbackRef<SetterCallback>{&adapter::StaticInvoker::staticSetter<Var>};
+        }
+        return addStaticProperty(meta::StaticMemberDefine::Property{
+            name,
+            meta::CallbackRef<GetterCallback>{&adapter::StaticInvoker::staticGetter<Var>},
+            setter
+        });
+    }
+
+    /**
+     * 绑定构造函数，必须可被指定参数调用
+     * @note 仅支持一个构造签名，重载构造请使用 ClassDefineBuilder
+     */
+    template <typename... Args>
+    constexpr auto constructor() const
+        requires(isInstanceClass && State == ConstructorState::None)
+    {
+        static_assert(
+            !std::is_aggregate_v<Class> && std::is_constructible_v<Class, Args...>,
+            "Constructor must be callable with the specified arguments"
+        );
+        return withConstructor<ConstructorState::Normal>(
+            meta::CallbackRef<InstanceConstructor>{&adapter::StaticInvoker::constructor<Class, Args...>}
+        );
+    }
+
+    // 自定义构造逻辑 / Custom constructor: customConstructor<&fn>()，fn: void* (Arguments const&)
+    template <auto Fn>
+    constexpr auto customConstructor() const
+        requires(isInstanceClass && State == ConstructorState::None
+                 && std::is_convertible_v<decltype(Fn), void* (*)(Arguments const&)>)
+    {
+        return withConstructor<ConstructorState::Custom>(
+            meta::CallbackRef<InstanceConstructor>{&adapter::StaticInvoker::customConstructor<Fn>}
+        );
+    }
+
+    // 禁用构造函数，Js 无法通过 new 构造此类，也不生成托管工厂 / Disable the constructor
+    constexpr auto disableConstructor() const
+        requires(isInstanceClass && State == ConstructorState::None)
+    {
+        return withConstructor<ConstructorState::Disabled>(
+            meta::CallbackRef<InstanceConstructor>{&adapter::StaticInvoker::disabledConstructor}
+        );
+    }
+
+    // 实例方法 / Instance method: instanceMethod<&C::fn>("fn")
+    template <auto Method>
+    constexpr auto instanceMethod(std::string_view name) const
+        requires(isInstanceClass && std::is_member_function_pointer_v<decltype(Method)>)
+    {
+        return addInstanceMethod(meta::InstanceMemberDefine::Method{
+            name,
+            meta::CallbackRef<InstanceMethodCallback>{&adapter::StaticInvoker::instanceMethod<Class, Method>},
+            {},
+            adapter::bindInstanceMethodTrampoline<Class, Method>()
+        });
+    }
+
+    // 实例属性（成员变量）/ Instance property: instanceProperty<&C::member>("name")，按值传递，const 成员只读
+    template <auto Member>
+    constexpr auto instanceProperty(std::string_view name) const
+        requires(isInstanceClass && std::is_member_object_pointer_v<decltype(Member)>)
+    {
+        constexpr auto trampoline = adapter::bindInstancePropertyTrampoline<Class, Member>();
+
+        meta::CallbackRef<InstanceSetterCallback> setter{};
+        if constexpr (!std::is_const_v<traits::MemberType_t<decltype(Member)>>) {
+            setter = meta::CallbackRef<InstanceSetterCallback>{&adapter::StaticInvoker::instanceSetter<Class, Member>};
+        }
+        return addInstanceProperty(meta::InstanceMemberDefine::Property{
+            name,
+            meta::CallbackRef<InstanceGetterCallback>{&adapter::StaticInvoker::instanceGetter<Class, Member>},
+            setter,
+            trampoline.first,
+            trampoline.second
+        });
+    }
+
+    /**
+     * 设置继承关系 / Set base class
+     * @note 基类必须为一个实例类，且其 ClassDefine 具有静态存储期 (如同样由 ClassDefineTable 常量初始化)
+     */
+    constexpr auto extends(meta::ClassDefine const& parent) const
+        requires isInstanceClass
+    {
+        auto table  = table_;
+        table.base_ = &parent;
+        return ClassDefineTableBuilder{table};
+    }
+
+    [[nodiscard]] constexpr Table build() const {
+        static_assert(!isInstanceClass || State != ConstructorState::None, "No constructor provided");
+
+        auto table = table_;
+        if constexpr (isInstanceClass && State != ConstructorState::Disabled) {
+            table.factory_ = adapter::bindManagedResourceFactory<Class>();
+        } // else: script cannot construct instances; do not provide factory (C++ owns lifetime)
+        return table;
+    }
+};
+
+template <typename C>
+constexpr auto defineClassTable(std::string_view className) {
+    return ClassDefineTableBuilder<C>(className);
+}
+
+} // namespace v8wrap::bind
@@ -2,16 +2,61 @@
 #include "MemberDefine.h"
 #include "v8wrap/bind/JsManagedResource.h"
 
+#include <array>
+#include <cstddef>
+#include <deque>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace v8wrap::bind::meta {
 
 
+/**
+ * ClassDefineBuilder 构建的类定义所持有的存储
+ * 成员表中的名称 (string_view) 与回调 (CallbackRef) 均指向此处，地址在存储的生命周期内不变
+ */
+class ClassDefineStorage {
+public:
+    std::string_view name(std::string name) { return names_.emplace_back(std::move(name)); }
+
+    template <typename Fn>
+    CallbackRef<Fn> callback(Fn fn) {
+        if (!fn) {
+            return {};
+        }
+        auto            owned = std::make_shared<Fn const>(std::move(fn));
+        CallbackRef<Fn> ref{*owned};
+        owned_.push_back(std::move(owned));
+        return ref;
+    }
+
+    // 持有回调引用的其他对象 (如 FastCallback::data_)
+    void keep(std::shared_ptr<void const> owned) {
+        if (owned) {
+            owned_.push_back(std::move(owned));
+        }
+    }
+
+    std::vector<StaticMemberDefine::Property>   staticProperty_;
+    std::vector<StaticMemberDefine::Function>   staticFunctions_;
+    std::vector<InstanceMemberDefine::Property> instanceProperty_;
+    std::vector<InstanceMemberDefine::Method>   instanceMethods_;
+
+private:
+    std::deque<std::string>                  names_; // deque 追加元素时不移动已有元素
+    std::vector<std::shared_ptr<void const>> owned_;
+};
+
+template <size_t NSP, size_t NSF, size_t NIP, size_t NIM>
+struct ClassDefineTable;
+
+
 class ClassDefine {
 public:
-    std::string const          name_;
+    std::string_view const     name_;
     StaticMemberDefine const   staticMemberDef_;
     InstanceMemberDefine const instanceMemberDef_;
     ClassDefine const*         base_{nullptr};
@@ -38,20 +83,65 @@ public:
     }
 
     explicit ClassDefine(
-        std::string          name,
+        std::string_view     name,
         StaticMemberDefine   staticDef,
         InstanceMemberDefine instanceDef,
         ClassDefine const*   base,
         // reflection::TypeId     typeId,
-        ManagedResourceFactory factory
+        ManagedResourceFactory                    factory,
+        std::shared_ptr<ClassDefineStorage const> storage
     )
-    : name_(std::move(name)),
-      staticMemberDef_(std::move(staticDef)),
-      instanceMemberDef_(std::move(instanceDef)),
+    : name_(name),
+      staticMemberDef_(staticDef),
+      instanceMemberDef_(instanceDef),
       base_(base),
       //   typeId_(std::move(typeId)),
-      factory_(factory) {}
+      factory_(factory),
+      storage_(std::move(storage)) {}
+
+    /**
+     * 引用静态存储中的成员表，不分配内存，可用于常量初始化
+     * @code
+     * constexpr auto FooTable = bind::defineClassTable<Foo>("Foo").constructor<>().instanceMethod<&Foo::bar>("bar")
+     *                               .build();
+     * constinit bind::meta::ClassDefine const FooBind{FooTable};
+     */
+    template <size_t NSP, size_t NSF, size_t NIP, size_t NIM>
+    constexpr explicit ClassDefine(ClassDefineTable<NSP, NSF, NIP, NIM> const& table)
+    : name_(table.name_),
+      staticMemberDef_(table.staticProperty_, table.staticFunctions_),
+      instanceMemberDef_(
+          table.constructor_,
+          table.instanceProperty_,
+          table.instanceMethods_,
+          table.classSize_,
+          table.equals_
+      ),
+      base_(table.base_),
+      factory_(table.factory_) {}
+
+private:
+    std::shared_ptr<ClassDefineStorage const> storage_{}; // ClassDefineBuilder 构建时持有名称与回调，静态存储时为空
+};
+
+
+/**
+ * 静态存储的类定义成员表 (定长数组)，由 ClassDefineTableBuilder 在编译期生成
+ * @note 对象需具有静态存储期，ClassDefine 只引用其中的数组
+ */
+template <size_t NSP, size_t NSF, size_t NIP, size_t NIM>
+struct ClassDefineTable {
+    std::string_view                                name_;
+    std::array<StaticMemberDefine::Property, NSP>   staticProperty_;
+    std::array<StaticMemberDefine::Function, NSF>   staticFunctions_;
+    CallbackRef<InstanceConstructor>                constructor_;
+    std::array<InstanceMemberDefine::Property, NIP> instanceProperty_;
+    std::array<InstanceMemberDefine::Method, NIM>   instanceMethods_;
+    size_t                                          classSize_;
+    InstanceMemberDefine::InstanceEqualsCallback    equals_;
+    ClassDefine const*                              base_;
+    ClassDefine::ManagedResourceFactory             factory_;
 };
 
 
-} // namespace v8wrap::bind::meta
\ No newline at end of file
+} // namespace v8wrap::bind::meta
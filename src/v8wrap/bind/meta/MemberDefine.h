@@ -2,79 +2,176 @@
 #include "v8wrap/Types.h"
 
 #include <cstddef>
-#include <string>
+#include <functional>
+#include <span>
+#include <string_view>
+#include <utility>
+
+V8_WRAP_WARNING_GUARD_BEGIN
+#include <v8-fast-api-calls.h>
+#include <v8-function-callback.h>
+V8_WRAP_WARNING_GUARD_END
 
 
 namespace v8wrap::bind::meta {
 
 
+/**
+ * 非拥有的回调引用：调用函数指针 + 数据指针，可在编译期构造 (常量初始化)
+ * - ClassDefineBuilder 构建的定义：指向 ClassDefine 存储中的 std::function
+ * - ClassDefineTable 构建的定义：指向编译期生成的函数，数据为空
+ * @tparam Fn 对应的 std::function 类型，如 CallbackRef<FunctionCallback>
+ */
+template <typename Fn>
+class CallbackRef;
+
+template <typename R, typename... Args>
+class CallbackRef<std::function<R(Args...)>> {
+public:
+    using Invoker = R (*)(void const* data, Args... args);
+
+    constexpr CallbackRef() = default;
+    constexpr CallbackRef(std::nullptr_t) {} // NOLINT(google-explicit-constructor)
+
+    constexpr explicit CallbackRef(Invoker invoker, void const* data = nullptr) : invoker_(invoker), data_(data) {}
+
+    // 引用 std::function，调用方需保证其生命周期；空的 std::function 得到空引用
+    explicit CallbackRef(std::function<R(Args...)> const& fn)
+    : invoker_(fn ? &invokeFunction : nullptr),
+      data_(fn ? &fn : nullptr) {}
+
+    R operator()(Args... args) const { return invoker_(data_, std::forward<Args>(args)...); }
+
+    [[nodiscard]] constexpr explicit operator bool() const { return invoker_ != nullptr; }
+
+    friend constexpr bool operator==(CallbackRef const& ref, std::nullptr_t) { return ref.invoker_ == nullptr; }
+
+private:
+    static R invokeFunction(void const* data, Args... args) {
+        return (*static_cast<std::function<R(Args...)> const*>(data))(std::forward<Args>(args)...);
+    }
+
+    Invoker     invoker_{nullptr};
+    void const* data_{nullptr};
+};
+
+
+/**
+ * V8 Fast API 回调 (可选)
+ * @note 仅当绑定的 C++ 函数为 noexcept 且参数、返回值均为原始类型时由 adapter 生成
+ * @note function_ 通过 FastApiCallbackOptions::data 取回所属的成员定义，再从 data_ 取回原始的 C++ 可调用对象
+ * @note data_ 不持有可调用对象，其所有权在 ClassDefine 的存储中
+ */
+struct FastCallback {
+    v8::CFunction function_{};
+    void const*   data_{nullptr};
+
+    [[nodiscard]] constexpr bool valid() const { return data_ != nullptr; }
+};
+
+/**
+ * 成员定义均为非拥有的视图 (名称为 string_view，成员表为 span)，可放在静态存储中并在编译期构造
+ * 名称与回调的所有权见 ClassDefineStorage (ClassDefineBuilder) 与 ClassDefineTable (静态存储)
+ */
 struct StaticMemberDefine {
     struct Property {
-        std::string const    name_;
-        GetterCallback const getter_;
-        SetterCallback const setter_;
-
-        explicit Property(std::string name, GetterCallback getter, SetterCallback setter)
-        : name_(std::move(name)),
-          getter_(std::move(getter)),
-          setter_(std::move(setter)) {}
+        std::string_view const            name_;
+        CallbackRef<GetterCallback> const getter_;
+        CallbackRef<SetterCallback> const setter_;
+
+        constexpr explicit Property(
+            std::string_view            name,
+            CallbackRef<GetterCallback> getter,
+            CallbackRef<SetterCallback> setter
+        )
+        : name_(name),
+          getter_(getter),
+          setter_(setter) {}
     };
     struct Function {
-        std::string const      name_;
-        FunctionCallback const callback_;
-
-        explicit Function(std::string name, FunctionCallback callback)
-        : name_(std::move(name)),
-          callback_(std::move(callback)) {}
+        std::string_view const              name_;
+        CallbackRef<FunctionCallback> const callback_;
+        FastCallback const                  fastCallback_;
+        v8::FunctionCallback const          trampoline_; // 编译期生成的回调 (可选)，存在时代替 callback_ 注册
+
+        constexpr explicit Function(
+            std::string_view              name,
+            CallbackRef<FunctionCallback> callback,
+            FastCallback                  fastCallback = {},
+            v8::FunctionCallback          trampoline   = nullptr
+        )
+        : name_(name),
+          callback_(callback),
+          fastCallback_(fastCallback),
+          trampoline_(trampoline) {}
     };
 
-    std::vector<Property> const property_;
-    std::vector<Function> const functions_;
+    std::span<Property const> const property_;
+    std::span<Function const> const functions_;
 
-    explicit StaticMemberDefine(std::vector<Property> property, std::vector<Function> functions)
-    : property_(std::move(property)),
-      functions_(std::move(functions)) {}
+    constexpr explicit StaticMemberDefine(std::span<Property const> property, std::span<Function const> functions)
+    : property_(property),
+      functions_(functions) {}
 };
 
 struct InstanceMemberDefine {
     struct Property {
-        std::string const            name_;
-        InstanceGetterCallback const getter_;
-        InstanceSetterCallback const setter_;
-
-        explicit Property(std::string name, InstanceGetterCallback getter, InstanceSetterCallback setter)
-        : name_(std::move(name)),
-          getter_(std::move(getter)),
-          setter_(std::move(setter)) {}
+        std::string_view const                    name_;
+        CallbackRef<InstanceGetterCallback> const getter_;
+        CallbackRef<InstanceSetterCallback> const setter_;
+        v8::FunctionCallback const                getterTrampoline_; // 编译期生成的回调 (可选)
+        v8::FunctionCallback const                setterTrampoline_;
+
+        constexpr explicit Property(
+            std::string_view                    name,
+            CallbackRef<InstanceGetterCallback> getter,
+            CallbackRef<InstanceSetterCallback> setter,
+            v8::FunctionCallback                getterTrampoline = nullptr,
+            v8::FunctionCallback                setterTrampoline = nullptr
+        )
+        : name_(name),
+          getter_(getter),
+          setter_(setter),
+          getterTrampoline_(getterTrampoline),
+          setterTrampoline_(setterTrampoline) {}
     };
     struct Method {
-        std::string const            name_;
-        InstanceMethodCallback const callback_;
-
-        explicit Method(std::string name, InstanceMethodCallback callback)
-        : name_(std::move(name)),
-          callback_(std::move(callback)) {}
+        std::string_view const                    name_;
+        CallbackRef<InstanceMethodCallback> const callback_;
+        FastCallback const                        fastCallback_;
+        v8::FunctionCallback const                trampoline_; // 编译期生成的回调 (可选)
+
+        constexpr explicit Method(
+            std::string_view                    name,
+            CallbackRef<InstanceMethodCallback> callback,
+            FastCallback                        fastCallback = {},
+            v8::FunctionCallback                trampoline   = nullptr
+        )
+        : name_(name),
+          callback_(callback),
+          fastCallback_(fastCallback),
+          trampoline_(trampoline) {}
     };
 
-    InstanceConstructor const   constructor_;
-    std::vector<Property> const property_;
-    std::vector<Method> const   methods_;
-    size_t const                classSize_{0}; // sizeof(C) for instance class
+    CallbackRef<InstanceConstructor> const constructor_;
+    std::span<Property const> const        property_;
+    std::span<Method const> const          methods_;
+    size_t const                           classSize_{0}; // sizeof(C) for instance class
 
     // script helper
     using InstanceEqualsCallback = bool (*)(void* lhs, void* rhs);
     InstanceEqualsCallback const equals_{nullptr};
 
-    explicit InstanceMemberDefine(
-        InstanceConstructor    constructor,
-        std::vector<Property>  property,
-        std::vector<Method>    functions,
-        size_t                 classSize,
-        InstanceEqualsCallback equals
+    constexpr explicit InstanceMemberDefine(
+        CallbackRef<InstanceConstructor> constructor,
+        std::span<Property const>        property,
+        std::span<Method const>          functions,
+        size_t                           classSize,
+        InstanceEqualsCallback           equals
     )
-    : constructor_(std::move(constructor)),
-      property_(std::move(property)),
-      methods_(std::move(functions)),
+    : constructor_(constructor),
+      property_(property),
+      methods_(functions),
       classSize_(classSize),
       equals_(equals) {}
 };
@@ -13,6 +13,9 @@ concept NumberLike = std::is_arithmetic_v<T>;
 template <typename T>
 concept StringLike = std::convertible_to<T, std::string_view>;
 
+template <typename T>
+concept U16StringLike = std::convertible_to<T, std::u16string_view>;
+
 template <typename T>
 concept HasDefaultConstructor = requires { T{}; };
 
@@ -12,7 +12,8 @@ template <typename T>
 concept JsValueType =
     std::same_as<T, Value> || std::same_as<T, Undefined> || std::same_as<T, Null> || std::same_as<T, Boolean>
     || std::same_as<T, Number> || std::same_as<T, String> || std::same_as<T, Object> || std::same_as<T, Array>
-    || std::same_as<T, Function> || std::same_as<T, BigInt> || std::same_as<T, Symbol>;
+    || std::same_as<T, Function> || std::same_as<T, BigInt> || std::same_as<T, Symbol> || std::same_as<T, ArrayBuffer>
+    || std::same_as<T, TypedArray> || std::same_as<T, DataView>;
 
 
 template <typename T>
@@ -1,20 +1,91 @@
 #include "v8wrap/reference/Local.h"
+#include "v8wrap/runtime/Engine.h"
 #include "v8wrap/runtime/EngineScope.h"
 #include "v8wrap/runtime/Exception.h"
 #include "v8wrap/types/Value.h"
+#include "v8wrap/types/internal/StringHelper.h"
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <vector>
 
 
 V8_WRAP_WARNING_GUARD_BEGIN
+#include <v8-array-buffer.h>
 #include <v8-exception.h>
 #include <v8-local-handle.h>
 #include <v8-primitive.h>
+#include <v8-typed-array.h>
 #include <v8-value.h>
 V8_WRAP_WARNING_GUARD_END
 
 namespace v8wrap {
 
+namespace {
+
+/**
+ * 单次 Local 操作的异常处理
+ * - 存在 ErrorScope 时复用其缓存的 isolate/context 与 TryCatch，失败只记录到 ErrorScope
+ * - 否则查询 EngineScope 并为本次操作创建 TryCatch，失败时抛出 Exception
+ */
+class OperationScope {
+public:
+    OperationScope() : outer_(ErrorScope::current()) {
+        if (outer_ != nullptr) {
+            isolate_ = outer_->isolate();
+            context_ = outer_->context();
+        } else {
+            std::tie(isolate_, context_) = EngineScope::currentIsolateAndContextChecked();
+            vtry_.emplace(isolate_);
+        }
+    }
+
+    [[nodiscard]] v8::Isolate* isolate() const { return isolate_; }
+
+    [[nodiscard]] v8::Local<v8::Context> const& context() const { return context_; }
+
+    [[nodiscard]] v8::Local<v8::Value> undefined() const { return v8::Undefined(isolate_); }
+
+    // ErrorScope 中已有失败时，后续操作直接跳过
+    [[nodiscard]] bool skip() const { return outer_ != nullptr && outer_->hasError(); }
+
+    // 返回 false 表示操作失败 (仅在 ErrorScope 中返回，否则抛出)
+    template <typename T>
+    bool check(v8::MaybeLocal<T> const& maybe) {
+        return check(maybe.IsEmpty());
+    }
+
+    template <typename T>
+    bool check(v8::Maybe<T> const& maybe) {
+        return check(maybe.IsNothing());
+    }
+
+private:
+    bool check(bool failed) {
+        if (vtry_) {
+            Exception::rethrow(*vtry_);
+            if (failed) [[unlikely]] {
+                throw Exception{"V8 operation failed without an exception"};
+            }
+            return true;
+        }
+        if (failed) [[unlikely]] {
+            outer_->markFailed();
+            return false;
+        }
+        return true;
+    }
+
+    ErrorScope*                 outer_;
+    v8::Isolate*                isolate_{nullptr};
+    v8::Local<v8::Context>      context_;
+    std::optional<v8::TryCatch> vtry_;
+};
+
+} // namespace
+
 
 // Local<Value>
 Local<Value>::Local() noexcept : val(Undefined::newUndefined().val){}; // default constructor
@@ -29,6 +100,9 @@ bool Local<Value>::isSymbol() const { return !isNullOrUndefined() && val->IsSymb
 bool Local<Value>::isObject() const { return !isNullOrUndefined() && val->IsObject(); }
 bool Local<Value>::isArray() const { return !isNullOrUndefined() && val->IsArray(); }
 bool Local<Value>::isFunction() const { return !isNullOrUndefined() && val->IsFunction(); }
+bool Local<Value>::isArrayBuffer() const { return !isNullOrUndefined() && val->IsArrayBuffer(); }
+bool Local<Value>::isTypedArray() const { return !isNullOrUndefined() && val->IsTypedArray(); }
+bool Local<Value>::isDataView() const { return !isNullOrUndefined() && val->IsDataView(); }
 
 Local<Value> Local<Value>::asValue() const { return *this; }
 Local<Null>  Local<Value>::asNull() const {
@@ -71,6 +145,18 @@ Local<Function> Local<Value>::asFunction() const {
     if (isFunction()) return Local<Function>{val.As<v8::Function>()};
     throw Exception("cannot convert to Function");
 }
+Local<ArrayBuffer> Local<Value>::asArrayBuffer() const {
+    if (isArrayBuffer()) return Local<ArrayBuffer>{val.As<v8::ArrayBuffer>()};
+    throw Exception("cannot convert to ArrayBuffer");
+}
+Local<TypedArray> Local<Value>::asTypedArray() const {
+    if (isTypedArray()) return Local<TypedArray>{val.As<v8::TypedArray>()};
+    throw Exception("cannot convert to TypedArray");
+}
+Local<DataView> Local<Value>::asDataView() const {
+    if (isDataView()) return Local<DataView>{val.As<v8::DataView>()};
+    throw Exception("cannot convert to DataView");
+}
 
 void Local<Value>::clear() { val.Clear(); }
 
@@ -82,6 +168,9 @@ ValueType Local<Value>::getType() const {
     if (isBigInt()) return ValueType::BigInt;
     if (isString()) return ValueType::String;
     if (isSymbol()) return ValueType::Symbol;
+    if (isArrayBuffer()) return ValueType::ArrayBuffer;
+    if (isTypedArray()) return ValueType::TypedArray;
+    if (isDataView()) return ValueType::DataView;
     if (isObject()) return ValueType::Object;
     if (isArray()) return ValueType::Array;
     if (isFunction()) return ValueType::Function;
@@ -107,8 +196,8 @@ ValueType Local<Value>::getType() const {
         return *this;                                                                                                  \
     }                                                                                                                  \
     Local<String> Local<VALUE>::toString() {                                                                           \
-        if (asValue().isNull()) return String::newString("null");                                                      \
-        if (asValue().isUndefined()) return String::newString("undefined");                                            \
+        if (asValue().isNull()) return String::newStaticString("null");                                                \
+        if (asValue().isUndefined()) return String::newStaticString("undefined");                                      \
         auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();                                        \
         v8::TryCatch vtry{isolate};                                                                                    \
         auto         maybe = val->ToString(ctx);                                                                       \
@@ -161,13 +250,54 @@ IMPL_SPECALIZATION_AS_VALUE(String);
 IMPL_SPECALIZATION_V8_LOCAL_TYPE(String);
 int         Local<String>::length() const { return val->Length(); }
 std::string Local<String>::getValue() const {
-    auto                  isolate = EngineScope::currentRuntimeIsolateChecked();
+    auto isolate = EngineScope::currentRuntimeIsolateChecked();
+    if (val->IsOneByte()) {
+        // 单字节字符串按字节读取后自行展开，跳过 V8 的 UTF-8 编码
+        std::string result(static_cast<size_t>(val->Length()), '\0');
+        val->WriteOneByte(
+            isolate,
+            reinterpret_cast<uint8_t*>(result.data()),
+            0,
+            static_cast<int>(result.size()),
+            v8::String::NO_NULL_TERMINATION
+        );
+        internal::latin1ToUtf8(result);
+        return result;
+    }
     v8::String::Utf8Value utf8(isolate, val);
     if (*utf8 == nullptr) {
         throw Exception("Cannot convert v8::String to std::string");
     }
     return std::string{*utf8, static_cast<size_t>(utf8.length())};
 }
+std::u16string Local<String>::getU16Value() const {
+    auto           isolate = EngineScope::currentRuntimeIsolateChecked();
+    std::u16string result(static_cast<size_t>(val->Length()), u'\0');
+    val->Write(
+        isolate,
+        reinterpret_cast<uint16_t*>(result.data()),
+        0,
+        static_cast<int>(result.size()),
+        v8::String::NO_NULL_TERMINATION
+    );
+    return result;
+}
+bool        Local<String>::isOneByte() const { return val->ContainsOnlyOneByte(); }
+std::string Local<String>::getLatin1Value() const {
+    if (!val->ContainsOnlyOneByte()) {
+        throw Exception("String contains non Latin-1 characters");
+    }
+    auto        isolate = EngineScope::currentRuntimeIsolateChecked();
+    std::string result(static_cast<size_t>(val->Length()), '\0');
+    val->WriteOneByte(
+        isolate,
+        reinterpret_cast<uint8_t*>(result.data()),
+        0,
+        static_cast<int>(result.size()),
+        v8::String::NO_NULL_TERMINATION
+    );
+    return result;
+}
 
 
 IMPL_SPECIALIZATION_LOCAL(Symbol);
@@ -184,51 +314,59 @@ IMPL_SPECIALIZATION_LOCAL(Object);
 IMPL_SPECALIZATION_AS_VALUE(Object);
 IMPL_SPECALIZATION_V8_LOCAL_TYPE(Object);
 bool Local<Object>::has(Local<String> const& key) const {
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
-    auto         maybe = val->Has(ctx, key.val);
-    Exception::rethrow(vtry);
-    return maybe.ToChecked();
+    OperationScope op;
+    if (op.skip()) return false;
+    auto maybe = val->Has(op.context(), key.val);
+    return op.check(maybe) && maybe.FromJust();
 }
 
 Local<Value> Local<Object>::get(Local<String> const& key) const {
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
-    auto         maybe = val->Get(ctx, key.val);
-    Exception::rethrow(vtry);
-    return Local<Value>{maybe.ToLocalChecked()};
+    OperationScope op;
+    if (op.skip()) return Local<Value>{op.undefined()};
+    auto maybe = val->Get(op.context(), key.val);
+    return Local<Value>{op.check(maybe) ? maybe.ToLocalChecked() : op.undefined()};
 }
 
 void Local<Object>::set(Local<String> const& key, Local<Value> const& value) {
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
-    val->Set(ctx, key.val, value.val).ToChecked();
-    Exception::rethrow(vtry);
+    OperationScope op;
+    if (op.skip()) return;
+    (void)op.check(val->Set(op.context(), key.val, value.val));
 }
 
 void Local<Object>::remove(Local<String> const& key) {
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
-    val->Delete(ctx, key.val).ToChecked();
-    Exception::rethrow(vtry);
+    OperationScope op;
+    if (op.skip()) return;
+    (void)op.check(val->Delete(op.context(), key.val));
+}
+
+bool Local<Object>::has(std::string_view key) const { return has(EngineScope::currentRuntimeChecked().intern(key)); }
+
+Local<Value> Local<Object>::get(std::string_view key) const {
+    return get(EngineScope::currentRuntimeChecked().intern(key));
+}
+
+void Local<Object>::set(std::string_view key, Local<Value> const& value) {
+    set(EngineScope::currentRuntimeChecked().intern(key), value);
 }
 
+void Local<Object>::remove(std::string_view key) { remove(EngineScope::currentRuntimeChecked().intern(key)); }
+
 std::vector<Local<String>> Local<Object>::getOwnPropertyNames() const {
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
+    OperationScope op;
+    if (op.skip()) return {};
 
-    auto maybe = val->GetOwnPropertyNames(ctx);
-    Exception::rethrow(vtry);
+    auto maybe = val->GetOwnPropertyNames(op.context());
+    if (!op.check(maybe)) return {};
     auto array = maybe.ToLocalChecked();
 
     std::vector<Local<String>> result;
     result.reserve(array->Length());
 
     for (uint32_t i = 0; i < array->Length(); ++i) {
-        internal::V8EscapeScope scope{isolate};
+        internal::V8EscapeScope scope{op.isolate()};
 
-        auto maybeVal = array->Get(ctx, i);
-        Exception::rethrow(vtry);
+        auto maybeVal = array->Get(op.context(), i);
+        if (!op.check(maybeVal)) break;
         auto value = maybeVal.ToLocalChecked();
         if (value->IsString()) {
             result.push_back(Local<String>{scope.escape(value.As<v8::String>())});
@@ -252,12 +390,11 @@ bool Local<Object>::instanceof(Local<Value> const& type) const {
     if (!type.isObject()) {
         return false;
     }
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
+    OperationScope op;
+    if (op.skip()) return false;
 
-    auto maybe = val->InstanceOf(ctx, type.asObject().val);
-    Exception::rethrow(vtry);
-    return maybe.ToChecked();
+    auto maybe = val->InstanceOf(op.context(), type.asObject().val);
+    return op.check(maybe) && maybe.FromJust();
 }
 
 bool Local<Object>::defineOwnProperty(
@@ -265,21 +402,19 @@ bool Local<Object>::defineOwnProperty(
     Local<Value> const&  value,
     PropertyAttribute    attrs
 ) const {
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
+    OperationScope op;
+    if (op.skip()) return false;
 
-    auto maybe = val->DefineOwnProperty(ctx, key.val, value.val, attrs);
-    Exception::rethrow(vtry);
-    return maybe.ToChecked();
+    auto maybe = val->DefineOwnProperty(op.context(), key.val, value.val, attrs);
+    return op.check(maybe) && maybe.FromJust();
 }
 
 bool Local<Object>::defineProperty(Local<String> const& key, PropertyDescriptor& desc) const {
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
+    OperationScope op;
+    if (op.skip()) return false;
 
-    auto maybe = val->DefineProperty(ctx, key.val, desc);
-    Exception::rethrow(vtry);
-    return maybe.ToChecked();
+    auto maybe = val->DefineProperty(op.context(), key.val, desc);
+    return op.check(maybe) && maybe.FromJust();
 }
 
 
@@ -289,40 +424,54 @@ IMPL_SPECALIZATION_V8_LOCAL_TYPE(Array);
 size_t Local<Array>::length() const { return static_cast<size_t>(val->Length()); }
 
 Local<Value> Local<Array>::get(size_t index) const {
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
-    auto         maybe = val->Get(ctx, static_cast<uint32_t>(index));
-    Exception::rethrow(vtry);
-    return Local<Value>{maybe.ToLocalChecked()};
+    OperationScope op;
+    if (op.skip()) return Local<Value>{op.undefined()};
+    auto maybe = val->Get(op.context(), static_cast<uint32_t>(index));
+    return Local<Value>{op.check(maybe) ? maybe.ToLocalChecked() : op.undefined()};
 }
 
 void Local<Array>::set(size_t index, Local<Value> const& value) {
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
-    val->Set(ctx, static_cast<uint32_t>(index), value.val).ToChecked();
-    Exception::rethrow(vtry);
+    OperationScope op;
+    if (op.skip()) return;
+    (void)op.check(val->Set(op.context(), static_cast<uint32_t>(index), value.val));
 }
 
 void Local<Array>::push(Local<Value> const& value) {
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
-    val->Set(ctx, val->Length(), value.val).ToChecked();
-    Exception::rethrow(vtry);
+    OperationScope op;
+    if (op.skip()) return;
+    (void)op.check(val->Set(op.context(), val->Length(), value.val));
 }
 
 void Local<Array>::clear() {
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
+    OperationScope op;
+    if (op.skip()) return;
 
     // Method 1: Set length = 0
-    auto len_str = v8::String::NewFromUtf8Literal(isolate, "length");
-    val->Set(ctx, len_str, v8::Integer::New(isolate, 0)).ToChecked();
-
-    Exception::rethrow(vtry);
+    auto len_str = v8::String::NewFromUtf8Literal(op.isolate(), "length");
+    (void)op.check(val->Set(op.context(), len_str, v8::Integer::New(op.isolate(), 0)));
 }
 
 Local<Value> Local<Array>::operator[](size_t index) const { return get(index); }
 
+std::vector<Local<Value>> Local<Array>::toVector() const {
+    OperationScope op;
+    if (op.skip()) return {};
+
+    // v8::Array::Iterate 不允许元素句柄逃逸出回调，这里直接按下标读取
+    uint32_t const length = val->Length();
+
+    std::vector<Local<Value>> result;
+    result.reserve(length);
+    for (uint32_t i = 0; i < length; ++i) {
+        auto maybe = val->Get(op.context(), i);
+        if (!op.check(maybe)) {
+            break;
+        }
+        result.push_back(Local<Value>{maybe.ToLocalChecked()});
+    }
+    return result;
+}
+
 
 IMPL_SPECIALIZATION_LOCAL(Function);
 IMPL_SPECALIZATION_AS_VALUE(Function);
@@ -336,8 +485,8 @@ Local<Value> Local<Function>::call(Local<Value> const& thiz) const {
 }
 
 Local<Value> Local<Function>::call(Local<Value> const& thiz, std::span<const Local<Value>> args) const {
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
+    OperationScope op;
+    if (op.skip()) return Local<Value>{op.undefined()};
 
     int argc = static_cast<int>(args.size());
 
@@ -350,9 +499,12 @@ Local<Value> Local<Function>::call(Local<Value> const& thiz, std::span<const Loc
         argv = reinterpret_cast<v8::Local<v8::Value>*>(const_cast<Local<Value>*>(args.data()));
     }
 
-    auto result = val->Call(ctx, thiz.val, argc, argv);
-    Exception::rethrow(vtry);
-    return Local<Value>{result.ToLocalChecked()};
+    v8::MaybeLocal<v8::Value> result;
+    {
+        ErrorScope::Suspend suspend; // Js 回调到 C++ 时不使用外层的错误作用域
+        result = val->Call(op.context(), thiz.val, argc, argv);
+    }
+    return Local<Value>{op.check(result) ? result.ToLocalChecked() : op.undefined()};
 }
 
 Local<Value> Local<Function>::callAsConstructor() const { return callAsConstructor(std::span<const Local<Value>>{}); }
@@ -361,8 +513,8 @@ Local<Value> Local<Function>::callAsConstructor(std::span<const Local<Value>> ar
     if (!isConstructor()) {
         throw std::logic_error("Local<Function>::callAsConstructor called on non-constructor");
     }
-    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
-    v8::TryCatch vtry{isolate};
+    OperationScope op;
+    if (op.skip()) return Local<Value>{op.undefined()};
 
     int argc = static_cast<int>(args.size());
 
@@ -375,10 +527,60 @@ Local<Value> Local<Function>::callAsConstructor(std::span<const Local<Value>> ar
         argv = reinterpret_cast<v8::Local<v8::Value>*>(const_cast<Local<Value>*>(args.data()));
     }
 
-    auto result = val->CallAsConstructor(ctx, argc, argv);
-    Exception::rethrow(vtry);
-    return Local<Value>{result.ToLocalChecked()};
+    v8::MaybeLocal<v8::Value> result;
+    {
+        ErrorScope::Suspend suspend;
+        result = val->CallAsConstructor(op.context(), argc, argv);
+    }
+    return Local<Value>{op.check(result) ? result.ToLocalChecked() : op.undefined()};
+}
+
+
+IMPL_SPECIALIZATION_LOCAL(ArrayBuffer);
+IMPL_SPECALIZATION_AS_VALUE(ArrayBuffer);
+IMPL_SPECALIZATION_V8_LOCAL_TYPE(ArrayBuffer);
+size_t Local<ArrayBuffer>::byteLength() const { return val->ByteLength(); }
+void*  Local<ArrayBuffer>::data() const { return val->Data(); }
+bool   Local<ArrayBuffer>::isDetached() const { return val->WasDetached(); }
+
+
+IMPL_SPECIALIZATION_LOCAL(TypedArray);
+IMPL_SPECALIZATION_AS_VALUE(TypedArray);
+IMPL_SPECALIZATION_V8_LOCAL_TYPE(TypedArray);
+TypedArrayType Local<TypedArray>::type() const {
+    if (val->IsInt8Array()) return TypedArrayType::Int8;
+    if (val->IsUint8Array()) return TypedArrayType::Uint8;
+    if (val->IsUint8ClampedArray()) return TypedArrayType::Uint8Clamped;
+    if (val->IsInt16Array()) return TypedArrayType::Int16;
+    if (val->IsUint16Array()) return TypedArrayType::Uint16;
+    if (val->IsInt32Array()) return TypedArrayType::Int32;
+    if (val->IsUint32Array()) return TypedArrayType::Uint32;
+    if (val->IsFloat32Array()) return TypedArrayType::Float32;
+    if (val->IsFloat64Array()) return TypedArrayType::Float64;
+    if (val->IsBigInt64Array()) return TypedArrayType::BigInt64;
+    if (val->IsBigUint64Array()) return TypedArrayType::BigUint64;
+    throw Exception("Unknown TypedArray type");
+}
+size_t Local<TypedArray>::length() const { return val->Length(); }
+size_t Local<TypedArray>::byteOffset() const { return val->ByteOffset(); }
+size_t Local<TypedArray>::byteLength() const { return val->ByteLength(); }
+void*  Local<TypedArray>::data() const {
+    auto base = static_cast<std::byte*>(val->Buffer()->Data());
+    return base == nullptr ? nullptr : base + val->ByteOffset();
+}
+Local<ArrayBuffer> Local<TypedArray>::buffer() const { return Local<ArrayBuffer>{val->Buffer()}; }
+
+
+IMPL_SPECIALIZATION_LOCAL(DataView);
+IMPL_SPECALIZATION_AS_VALUE(DataView);
+IMPL_SPECALIZATION_V8_LOCAL_TYPE(DataView);
+size_t Local<DataView>::byteOffset() const { return val->ByteOffset(); }
+size_t Local<DataView>::byteLength() const { return val->ByteLength(); }
+void*  Local<DataView>::data() const {
+    auto base = static_cast<std::byte*>(val->Buffer()->Data());
+    return base == nullptr ? nullptr : base + val->ByteOffset();
 }
+Local<ArrayBuffer> Local<DataView>::buffer() const { return Local<ArrayBuffer>{val->Buffer()}; }
 
 
 #undef IMPL_SPECALIZATION_LOCAL
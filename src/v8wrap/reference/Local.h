@@ -4,7 +4,9 @@
 #include "v8wrap/concepts/ScriptConcepts.h"
 #include "v8wrap/types/internal/V8TypeAlias.h"
 #include <cstdint>
+#include <span>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -82,6 +84,9 @@ public:
     [[nodiscard]] bool isObject() const;
     [[nodiscard]] bool isArray() const;
     [[nodiscard]] bool isFunction() const;
+    [[nodiscard]] bool isArrayBuffer() const;
+    [[nodiscard]] bool isTypedArray() const;
+    [[nodiscard]] bool isDataView() const;
 
     [[nodiscard]] Local<Value>     asValue() const;
     [[nodiscard]] Local<Null>      asNull() const;
@@ -95,6 +100,10 @@ public:
     [[nodiscard]] Local<Array>     asArray() const;
     [[nodiscard]] Local<Function>  asFunction() const;
 
+    [[nodiscard]] Local<ArrayBuffer> asArrayBuffer() const;
+    [[nodiscard]] Local<TypedArray>  asTypedArray() const;
+    [[nodiscard]] Local<DataView>    asDataView() const;
+
     /**
      * @tparam T must be the type of as described above
      */
@@ -166,7 +175,17 @@ class Local<String> {
 
 public:
     [[nodiscard]] int         length() const;
-    [[nodiscard]] std::string getValue() const;
+    [[nodiscard]] std::string getValue() const; // UTF-8
+
+    [[nodiscard]] std::u16string getU16Value() const; // UTF-16
+
+    [[nodiscard]] bool isOneByte() const; // 所有字符均在 Latin-1 范围内
+
+    /**
+     * 以 Latin-1 编码读取，每个字符对应一个字节
+     * @throws Exception 字符串含有 Latin-1 以外的字符
+     */
+    [[nodiscard]] std::string getLatin1Value() const;
 };
 
 template <>
@@ -196,6 +215,15 @@ public:
 
     void remove(Local<String> const& key);
 
+    // 以下重载通过 Engine::intern 获取键，适用于固定的属性名
+    [[nodiscard]] bool has(std::string_view key) const;
+
+    [[nodiscard]] Local<Value> get(std::string_view key) const;
+
+    void set(std::string_view key, Local<Value> const& value);
+
+    void remove(std::string_view key);
+
     [[nodiscard]] std::vector<Local<String>> getOwnPropertyNames() const;
 
     [[nodiscard]] std::vector<std::string> getOwnPropertyNamesAsString() const;
@@ -229,6 +257,11 @@ public:
     void clear();
 
     Local<Value> operator[](size_t index) const;
+
+    /**
+     * 一次性取出所有元素（空洞为 undefined），整个过程只进行一次异常检查
+     */
+    [[nodiscard]] std::vector<Local<Value>> toVector() const;
 };
 
 template <>
@@ -258,6 +291,65 @@ public:
     [[nodiscard]] Local<Value> callAsConstructor(Args&&... args) const;
 };
 
+template <>
+class Local<ArrayBuffer> {
+    SPECIALIZATION_LOCAL(ArrayBuffer);
+    SPECALIZATION_AS_VALUE(ArrayBuffer);
+    SPECALIZATION_V8_LOCAL_TYPE(ArrayBuffer);
+
+public:
+    [[nodiscard]] size_t byteLength() const;
+
+    /**
+     * 底层存储的起始地址，已分离(detached)的 ArrayBuffer 返回 nullptr
+     */
+    [[nodiscard]] void* data() const;
+
+    [[nodiscard]] bool isDetached() const;
+};
+
+template <>
+class Local<TypedArray> {
+    SPECIALIZATION_LOCAL(TypedArray);
+    SPECALIZATION_AS_VALUE(TypedArray);
+    SPECALIZATION_V8_LOCAL_TYPE(TypedArray);
+
+public:
+    [[nodiscard]] TypedArrayType type() const;
+
+    [[nodiscard]] size_t length() const; // 元素个数
+
+    [[nodiscard]] size_t byteOffset() const;
+
+    [[nodiscard]] size_t byteLength() const;
+
+    /**
+     * 第一个元素的地址（已包含 byteOffset），不拷贝数据
+     */
+    [[nodiscard]] void* data() const;
+
+    [[nodiscard]] Local<ArrayBuffer> buffer() const;
+};
+
+template <>
+class Local<DataView> {
+    SPECIALIZATION_LOCAL(DataView);
+    SPECALIZATION_AS_VALUE(DataView);
+    SPECALIZATION_V8_LOCAL_TYPE(DataView);
+
+public:
+    [[nodiscard]] size_t byteOffset() const;
+
+    [[nodiscard]] size_t byteLength() const;
+
+    /**
+     * 视图起始地址（已包含 byteOffset），不拷贝数据
+     */
+    [[nodiscard]] void* data() const;
+
+    [[nodiscard]] Local<ArrayBuffer> buffer() const;
+};
+
 #undef SPECIALIZATION_LOCAL
 #undef SPECALIZATION_AS_VALUE
 #undef SPECALIZATION_V8_LOCAL_TYPE
@@ -34,6 +34,12 @@ Local<T> Local<Value>::as() const {
         return asObject();
     } else if constexpr (std::is_same_v<T, Array>) {
         return asArray();
+    } else if constexpr (std::is_same_v<T, ArrayBuffer>) {
+        return asArrayBuffer();
+    } else if constexpr (std::is_same_v<T, TypedArray>) {
+        return asTypedArray();
+    } else if constexpr (std::is_same_v<T, DataView>) {
+        return asDataView();
     }
     throw Exception("Unable to convert Local<Value> to T, forgot to add if branch?");
 }
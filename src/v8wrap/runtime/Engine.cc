@@ -1,5 +1,6 @@
 #include "v8wrap/runtime/Engine.h"
 #include "v8wrap/bind/JsManagedResource.h"
+#include "v8wrap/bind/Stream.h"
 #include "v8wrap/bind/meta/ClassDefine.h"
 #include "v8wrap/bind/meta/EnumDefine.h"
 #include "v8wrap/bind/meta/MemberDefine.h"
@@ -9,19 +10,29 @@
 #include "v8wrap/runtime/Platform.h"
 #include "v8wrap/types/Value.h"
 
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <deque>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <stdexcept>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 
 V8_WRAP_WARNING_GUARD_BEGIN
+#include "v8-container.h"
 #include "v8-external.h"
+#include "v8-fast-api-calls.h"
 #include "v8-function-callback.h"
 #include "v8-local-handle.h"
 #include "v8-object.h"
 #include "v8-primitive.h"
+#include "v8-promise.h"
 #include "v8-template.h"
 #include <v8-context.h>
 #include <v8-exception.h>
@@ -36,25 +47,26 @@ V8_WRAP_WARNING_GUARD_END
 namespace v8wrap {
 
 
-Engine::Engine() {
+Engine::Engine(ThreadMode mode) : isSingleThreaded_(mode == ThreadMode::SingleThreaded) {
     v8::Isolate::CreateParams params;
     params.array_buffer_allocator = v8::ArrayBuffer::Allocator::NewDefaultAllocator();
 
     isolate_ = v8::Isolate::New(params);
 
-    v8::Locker         locker(isolate_);
-    v8::Isolate::Scope isolate_scope(isolate_);
-    v8::HandleScope    handle_scope(isolate_);
-    context_.Reset(isolate_, v8::Context::New(isolate_));
-
-    constructorSymbol_ = v8::Global<v8::Symbol>(isolate_, v8::Symbol::New(isolate_));
+    internal::EngineLocker locker(*this);
+    v8::Isolate::Scope     isolate_scope(isolate_);
+    v8::HandleScope        handle_scope(isolate_);
+    auto                   context = v8::Context::New(isolate_);
+    context_.Reset(isolate_, context);
+    attachToIsolate(context);
 }
 
-Engine::Engine(v8::Isolate* isolate, v8::Local<v8::Context> context)
+Engine::Engine(v8::Isolate* isolate, v8::Local<v8::Context> context, ThreadMode mode)
 : isolate_(isolate),
   context_(v8::Global<v8::Context>{isolate, context}),
-  isExternalIsolate_(true) {
-    constructorSymbol_ = v8::Global<v8::Symbol>(isolate_, v8::Symbol::New(isolate_));
+  isExternalIsolate_(true),
+  isSingleThreaded_(mode == ThreadMode::SingleThreaded) {
+    attachToIsolate(context);
 }
 
 Engine::~Engine() {
@@ -62,6 +74,11 @@ Engine::~Engine() {
     isDestroying_ = true;
 
     if (userData_) userData_.reset();
+    {
+        std::lock_guard lock{pendingTasks_->mutex};
+        pendingTasks_->closed = true;
+        pendingTasks_->tasks.clear();
+    }
 
     {
         EngineScope scope(this);
@@ -74,11 +91,34 @@ Engine::~Engine() {
         for (auto& [_, ctor] : classConstructors_) {
             ctor.Reset();
         }
+        for (auto& [_, str] : internedStrings_) {
+            str.Reset();
+        }
+        for (auto& str : internedSlots_) {
+            str.Reset();
+        }
+        for (auto& shape : structShapes_) {
+            shape.template_.Reset();
+            for (auto& key : shape.keys_) key.Reset();
+        }
+        for (auto& [_, tmpl] : lazyObjectTemplates_) {
+            tmpl.Reset();
+        }
+        for (auto& [_, tmpl] : liveContainerTemplates_) {
+            tmpl.Reset();
+        }
+        rangeIteratorClass_.Reset();
+        streamClass_.Reset();
 
-        constructorSymbol_.Reset();
         classConstructors_.clear();
+        internedStrings_.clear();
+        internedSlots_.clear();
+        structShapes_.clear();
+        lazyObjectTemplates_.clear();
+        liveContainerTemplates_.clear();
         registeredClasses_.clear();
         managedResources_.clear();
+        detachFromIsolate();
         context_.Reset();
     }
 
@@ -87,13 +127,63 @@ Engine::~Engine() {
 
 
 v8::Isolate*           Engine::isolate() const { return isolate_; }
-v8::Local<v8::Context> Engine::context() const { return context_.Get(isolate_); }
+bool                   Engine::isSingleThreaded() const { return isSingleThreaded_; }
+v8::Local<v8::Context> Engine::context() const {
+    auto scope = EngineScope::gCurrentScope;
+    if (scope && scope->mRuntime == this) [[likely]] {
+        return scope->mContext; // 当前作用域已缓存
+    }
+    return context_.Get(isolate_);
+}
+
+Engine* Engine::fromContext(v8::Local<v8::Context> const& context) {
+    if (context.IsEmpty() || context->GetNumberOfEmbedderDataFields() <= kContextEmbedderDataIndex) {
+        return nullptr;
+    }
+    return static_cast<Engine*>(context->GetAlignedPointerFromEmbedderData(kContextEmbedderDataIndex));
+}
+
+namespace {
+
+// 已关联 isolate 的 Engine，用于区分 isolate 数据槽中的 Engine 与嵌入方写入的数据
+std::mutex                gAttachedEnginesMutex;
+std::unordered_set<void*> gAttachedEngines;
+
+} // namespace
+
+void Engine::attachToIsolate(v8::Local<v8::Context> const& context) {
+    context->SetAlignedPointerInEmbedderData(kContextEmbedderDataIndex, this);
+
+    std::lock_guard lock{gAttachedEnginesMutex};
+    gAttachedEngines.insert(this);
+
+    auto data = isolate_->GetData(kIsolateDataSlot);
+    if (data == nullptr) {
+        isolate_->SetData(kIsolateDataSlot, this);
+    } else if (gAttachedEngines.contains(data)) {
+        // 第二个 Engine 进入同一 isolate 后，数据槽不再指向单个 Engine，改为按 context 查找
+        isolate_->SetData(kIsolateDataSlot, const_cast<char*>(&kSharedIsolateTag));
+    } else if (data != &kSharedIsolateTag) {
+        // 数据槽已被嵌入方占用，保留原值，fromIsolate 改为按 context 查找
+        foreignIsolateData_.store(true, std::memory_order_relaxed);
+    }
+}
+
+void Engine::detachFromIsolate() {
+    context_.Get(isolate_)->SetAlignedPointerInEmbedderData(kContextEmbedderDataIndex, nullptr);
+
+    std::lock_guard lock{gAttachedEnginesMutex};
+    gAttachedEngines.erase(this);
+    if (isolate_->GetData(kIsolateDataSlot) == this) {
+        isolate_->SetData(kIsolateDataSlot, nullptr);
+    }
+}
 
 void Engine::setData(std::shared_ptr<void> data) { userData_ = std::move(data); }
 
 bool Engine::isDestroying() const { return isDestroying_; }
 
-Local<Value> Engine::eval(Local<String> const& code) { return eval(code, String::newString("<eval>")); }
+Local<Value> Engine::eval(Local<String> const& code) { return eval(code, String::newStaticString("<eval>")); }
 
 Local<Value> Engine::eval(Local<String> const& code, Local<String> const& source) {
     v8::TryCatch try_catch(isolate_);
@@ -132,11 +222,645 @@ Local<Value> Engine::getVauleFromGlobalThis(Local<String> const& key) const {
     return globalThis.get(key);
 }
 
+Local<Value> Engine::getVauleFromGlobalThis(std::string_view key) { return getVauleFromGlobalThis(intern(key)); }
+
 void Engine::setVauleToGlobalThis(Local<String> const& key, Local<Value> const& value) const {
     auto globalThis = getGlobalThis();
     globalThis.set(key, value);
 }
 
+void Engine::setVauleToGlobalThis(std::string_view key, Local<Value> const& value) {
+    setVauleToGlobalThis(intern(key), value);
+}
+
+namespace {
+
+v8::Local<v8::String> newInternalizedString(v8::Isolate* isolate, std::string_view str) {
+    v8::TryCatch vtry{isolate};
+
+    auto v8Str =
+        v8::String::NewFromUtf8(isolate, str.data(), v8::NewStringType::kInternalized, static_cast<int>(str.size()));
+    Exception::rethrow(vtry);
+    return v8Str.ToLocalChecked();
+}
+
+} // namespace
+
+Local<String> Engine::intern(std::string_view str) {
+    if (auto iter = internedStrings_.find(str); iter != internedStrings_.end()) {
+        return ValueHelper::wrap<String>(iter->second.Get(isolate_));
+    }
+    auto v8Str = newInternalizedString(isolate_, str);
+    if (internedStrings_.size() < kMaxInternedStrings) {
+        internedStrings_.emplace(std::string{str}, v8::Global<v8::String>{isolate_, v8Str});
+    }
+    return ValueHelper::wrap<String>(v8Str);
+}
+
+size_t Engine::nextInternSlot() noexcept {
+    static std::atomic<size_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+Engine::StructShape& Engine::getStructShape(size_t slot, std::span<std::string_view const> names) {
+    if (slot >= structShapes_.size()) {
+        structShapes_.resize(slot + 1);
+    }
+    auto& shape = structShapes_[slot];
+    if (shape.template_.IsEmpty()) {
+        // 预先声明所有字段，实例化后的对象共享同一形状，写入字段不会触发形状迁移
+        auto tmpl = v8::ObjectTemplate::New(isolate_);
+        shape.keys_.reserve(names.size());
+        for (auto name : names) {
+            auto key = ValueHelper::unwrap(intern(name));
+            tmpl->Set(key, v8::Undefined(isolate_));
+            shape.keys_.emplace_back(isolate_, key);
+        }
+        shape.template_.Reset(isolate_, tmpl);
+    }
+    return shape;
+}
+
+namespace {
+
+// LazyView 创建的对象在内部字段中持有的数据
+struct LazyObject {
+    bind::internal::LazyObjectDefine const* define;
+    std::shared_ptr<void const>             value;
+};
+
+constexpr int kLazyObjectInternalField = 0;
+
+LazyObject* getLazyObject(v8::Local<v8::Object> const& holder) {
+    return static_cast<LazyObject*>(holder->GetAlignedPointerFromInternalField(kLazyObjectInternalField));
+}
+
+// 结构体字段：首次读取后 V8 会以返回值替换惰性属性
+void lazyFieldGetter(v8::Local<v8::Name> /* property */, v8::PropertyCallbackInfo<v8::Value> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto lazy  = getLazyObject(info.Holder());
+    auto index = info.Data().As<v8::Uint32>()->Value();
+    try {
+        info.GetReturnValue().Set(ValueHelper::unwrap(lazy->define->getField_(lazy->value.get(), index)));
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+// 容器键：拦截器为 kNonMasking，首次读取后写回为自身属性，之后的读取不再经过拦截器
+void lazyEntryGetter(v8::Local<v8::Name> property, v8::PropertyCallbackInfo<v8::Value> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    if (!property->IsString()) return;
+    auto holder = info.Holder();
+    auto lazy   = getLazyObject(holder);
+    try {
+        auto         key = ValueHelper::wrap<String>(property.As<v8::String>()).getValue();
+        Local<Value> value;
+        if (!lazy->define->getEntry_(lazy->value.get(), key, value)) {
+            return;
+        }
+        auto v8Value = ValueHelper::unwrap(value);
+        if (holder->CreateDataProperty(info.GetIsolate()->GetCurrentContext(), property, v8Value).IsNothing()) {
+            return; // 异常已挂起在 V8 中，由调用方的 Js 代码接收
+        }
+        info.GetReturnValue().Set(v8Value);
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+void lazyEntryQuery(v8::Local<v8::Name> property, v8::PropertyCallbackInfo<v8::Integer> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    if (!property->IsString()) return;
+    auto lazy = getLazyObject(info.Holder());
+    try {
+        auto key = ValueHelper::wrap<String>(property.As<v8::String>()).getValue();
+        if (lazy->define->hasEntry_(lazy->value.get(), key)) {
+            info.GetReturnValue().Set(static_cast<int32_t>(v8::PropertyAttribute::None));
+        }
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+void lazyEntryEnumerator(v8::PropertyCallbackInfo<v8::Array> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto lazy = getLazyObject(info.Holder());
+    try {
+        info.GetReturnValue().Set(ValueHelper::unwrap(lazy->define->getKeys_(lazy->value.get())));
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+} // namespace
+
+v8::Local<v8::ObjectTemplate> Engine::getLazyObjectTemplate(bind::internal::LazyObjectDefine const& define) {
+    if (auto iter = lazyObjectTemplates_.find(&define); iter != lazyObjectTemplates_.end()) {
+        return iter->second.Get(isolate_);
+    }
+    auto tmpl = v8::ObjectTemplate::New(isolate_);
+    tmpl->SetInternalFieldCount(kLazyObjectInternalField + 1);
+    for (size_t i = 0; i < define.fields_.size(); ++i) {
+        tmpl->SetLazyDataProperty(
+            ValueHelper::unwrap(intern(define.fields_[i])),
+            &lazyFieldGetter,
+            v8::Integer::NewFromUnsigned(isolate_, static_cast<uint32_t>(i))
+        );
+    }
+    if (define.getEntry_ != nullptr) {
+        tmpl->SetHandler(v8::NamedPropertyHandlerConfiguration{
+            &lazyEntryGetter,
+            nullptr,
+            &lazyEntryQuery,
+            nullptr,
+            &lazyEntryEnumerator,
+            v8::Local<v8::Value>{},
+            static_cast<v8::PropertyHandlerFlags>(
+                static_cast<int>(v8::PropertyHandlerFlags::kNonMasking)
+                | static_cast<int>(v8::PropertyHandlerFlags::kOnlyInterceptStrings)
+            )
+        });
+    }
+    lazyObjectTemplates_.emplace(&define, v8::Global<v8::ObjectTemplate>{isolate_, tmpl});
+    return tmpl;
+}
+
+namespace {
+
+// ContainerRef 创建的对象在内部字段中持有的数据
+struct LiveContainerHolder {
+    bind::internal::LiveContainerDefine const* define;
+    void*                                      container;
+    v8::Global<v8::Value>                      owner; // 延长容器所属对象的生命周期
+};
+
+constexpr int kLiveContainerInternalField = 0;
+
+LiveContainerHolder* getLiveContainer(v8::Local<v8::Object> const& holder) {
+    return static_cast<LiveContainerHolder*>(holder->GetAlignedPointerFromInternalField(kLiveContainerInternalField));
+}
+
+void liveLengthGetter(v8::Local<v8::Name> /* property */, v8::PropertyCallbackInfo<v8::Value> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto live = getLiveContainer(info.Holder());
+    try {
+        info.GetReturnValue().Set(static_cast<double>(live->define->size_(live->container)));
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+void liveIndexGetter(uint32_t index, v8::PropertyCallbackInfo<v8::Value> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto live = getLiveContainer(info.Holder());
+    if (index >= live->define->size_(live->container)) return;
+    try {
+        info.GetReturnValue().Set(ValueHelper::unwrap(live->define->getIndex_(live->container, index)));
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+void liveIndexSetter(uint32_t index, v8::Local<v8::Value> value, v8::PropertyCallbackInfo<v8::Value> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto  live   = getLiveContainer(info.Holder());
+    auto& define = *live->define;
+    try {
+        auto size = define.size_(live->container);
+        if (index < size && define.setIndex_ != nullptr) {
+            define.setIndex_(live->container, index, ValueHelper::wrap<Value>(value));
+        } else if (index == size && define.append_ != nullptr) {
+            define.append_(live->container, ValueHelper::wrap<Value>(value));
+        } else {
+            throw Exception{
+                define.setIndex_ == nullptr ? "Container is read-only" : "Container index out of range",
+                define.setIndex_ == nullptr ? Exception::Type::TypeError : Exception::Type::RangeError
+            };
+        }
+        info.GetReturnValue().Set(value);
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+void liveIndexQuery(uint32_t index, v8::PropertyCallbackInfo<v8::Integer> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto live = getLiveContainer(info.Holder());
+    try {
+        if (index < live->define->size_(live->container)) {
+            info.GetReturnValue().Set(static_cast<int32_t>(v8::PropertyAttribute::DontDelete));
+        }
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+void liveIndexEnumerator(v8::PropertyCallbackInfo<v8::Array> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto live    = getLiveContainer(info.Holder());
+    auto isolate = info.GetIsolate();
+    try {
+        auto size = live->define->size_(live->container);
+
+        std::vector<v8::Local<v8::Value>> indices;
+        indices.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            indices.push_back(v8::Integer::NewFromUnsigned(isolate, static_cast<uint32_t>(i)));
+        }
+        info.GetReturnValue().Set(v8::Array::New(isolate, indices.data(), indices.size()));
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+void liveKeyGetter(v8::Local<v8::Name> property, v8::PropertyCallbackInfo<v8::Value> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto live = getLiveContainer(info.Holder());
+    try {
+        auto         key = ValueHelper::wrap<String>(property.As<v8::String>()).getValue();
+        Local<Value> value;
+        if (live->define->getKey_(live->container, key, value)) {
+            info.GetReturnValue().Set(ValueHelper::unwrap(value));
+        }
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+void liveKeySetter(
+    v8::Local<v8::Name>                        property,
+    v8::Local<v8::Value>                       value,
+    v8::PropertyCallbackInfo<v8::Value> const& info
+) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto live = getLiveContainer(info.Holder());
+    try {
+        if (live->define->setKey_ == nullptr) {
+            throw Exception{"Container is read-only", Exception::Type::TypeError};
+        }
+        auto key = ValueHelper::wrap<String>(property.As<v8::String>()).getValue();
+        live->define->setKey_(live->container, key, ValueHelper::wrap<Value>(value));
+        info.GetReturnValue().Set(value);
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+void liveKeyQuery(v8::Local<v8::Name> property, v8::PropertyCallbackInfo<v8::Integer> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto live = getLiveContainer(info.Holder());
+    try {
+        auto key = ValueHelper::wrap<String>(property.As<v8::String>()).getValue();
+        if (live->define->hasKey_(live->container, key)) {
+            info.GetReturnValue().Set(static_cast<int32_t>(v8::PropertyAttribute::None));
+        }
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+void liveKeyDeleter(v8::Local<v8::Name> property, v8::PropertyCallbackInfo<v8::Boolean> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto live = getLiveContainer(info.Holder());
+    if (live->define->deleteKey_ == nullptr) {
+        info.GetReturnValue().Set(false);
+        return;
+    }
+    try {
+        auto key = ValueHelper::wrap<String>(property.As<v8::String>()).getValue();
+        if (live->define->deleteKey_(live->container, key)) {
+            info.GetReturnValue().Set(true);
+        }
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+void liveKeyEnumerator(v8::PropertyCallbackInfo<v8::Array> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto live = getLiveContainer(info.Holder());
+    try {
+        info.GetReturnValue().Set(ValueHelper::unwrap(live->define->getKeys_(live->container)));
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+} // namespace
+
+v8::Local<v8::ObjectTemplate> Engine::getLiveContainerTemplate(bind::internal::LiveContainerDefine const& define) {
+    if (auto iter = liveContainerTemplates_.find(&define); iter != liveContainerTemplates_.end()) {
+        return iter->second.Get(isolate_);
+    }
+    auto tmpl = v8::ObjectTemplate::New(isolate_);
+    tmpl->SetInternalFieldCount(kLiveContainerInternalField + 1);
+    if (define.size_ != nullptr) {
+        tmpl->SetNativeDataProperty(
+            ValueHelper::unwrap(intern("length")),
+            &liveLengthGetter,
+            nullptr,
+            v8::Local<v8::Value>{},
+            v8::PropertyAttribute::DontEnum
+        );
+        tmpl->SetHandler(v8::IndexedPropertyHandlerConfiguration{
+            &liveIndexGetter,
+            &liveIndexSetter,
+            &liveIndexQuery,
+            nullptr,
+            &liveIndexEnumerator
+        });
+    } else {
+        tmpl->SetHandler(v8::NamedPropertyHandlerConfiguration{
+            &liveKeyGetter,
+            &liveKeySetter,
+            &liveKeyQuery,
+            &liveKeyDeleter,
+            &liveKeyEnumerator,
+            v8::Local<v8::Value>{},
+            v8::PropertyHandlerFlags::kOnlyInterceptStrings
+        });
+    }
+    liveContainerTemplates_.emplace(&define, v8::Global<v8::ObjectTemplate>{isolate_, tmpl});
+    return tmpl;
+}
+
+namespace {
+
+// Iterable 创建的迭代器在内部字段中持有的数据
+struct RangeIteratorHolder {
+    bind::internal::RangeIteratorDefine const* define;
+    void*                                      state; // 范围耗尽后提前释放
+    uint32_t                                   batchSize;
+    v8::Global<v8::Array>                      batch; // batchSize > 1 时暂存已转换的元素
+    uint32_t                                   batchLength{0};
+    uint32_t                                   cursor{0};
+
+    void release() {
+        if (state != nullptr) {
+            define->destroy_(state);
+            state = nullptr;
+        }
+    }
+
+    ~RangeIteratorHolder() { release(); }
+};
+
+constexpr int kRangeIteratorInternalField = 0;
+
+Local<Object> newIteratorResult(Local<Value> const& value, bool done) {
+    static size_t const               slot = bind::internal::StructShapeCache::nextSlot();
+    static constexpr std::string_view names[]{"value", "done"};
+    std::array<Local<Value>, 2> const values{value, Boolean::newBoolean(done)};
+    return bind::internal::StructShapeCache::newObject(slot, names, values);
+}
+
+void rangeIteratorNext(v8::FunctionCallbackInfo<v8::Value> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    // 接收者已由 Signature 校验
+    auto isolate = info.GetIsolate();
+    auto holder  = static_cast<RangeIteratorHolder*>(
+        info.This()->GetAlignedPointerFromInternalField(kRangeIteratorInternalField)
+    );
+    try {
+        if (holder->batchSize == 1) {
+            Local<Value> value;
+            if (holder->state != nullptr && holder->define->pull_(holder->state, {&value, 1}) == 1) {
+                info.GetReturnValue().Set(ValueHelper::unwrap(newIteratorResult(value, false)));
+                return;
+            }
+            holder->release();
+            info.GetReturnValue().Set(ValueHelper::unwrap(newIteratorResult({}, true)));
+            return;
+        }
+
+        if (holder->cursor == holder->batchLength && holder->state != nullptr) {
+            std::vector<Local<Value>> values(holder->batchSize);
+
+            auto count = holder->define->pull_(holder->state, values);
+            if (count < values.size()) {
+                holder->release(); // 已耗尽，无需等待迭代器被回收
+            }
+            values.resize(count);
+            holder->batch.Reset(isolate, ValueHelper::unwrap(Array::newArray(values)));
+            holder->batchLength = static_cast<uint32_t>(count);
+            holder->cursor      = 0;
+        }
+        if (holder->cursor == holder->batchLength) {
+            holder->batch.Reset();
+            info.GetReturnValue().Set(ValueHelper::unwrap(newIteratorResult({}, true)));
+            return;
+        }
+
+        v8::TryCatch vtry{isolate};
+        auto         value = holder->batch.Get(isolate)->Get(isolate->GetCurrentContext(), holder->cursor++);
+        Exception::rethrow(vtry);
+        info.GetReturnValue().Set(
+            ValueHelper::unwrap(newIteratorResult(ValueHelper::wrap<Value>(value.ToLocalChecked()), false))
+        );
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
+}
+
+void returnThis(v8::FunctionCallbackInfo<v8::Value> const& info) { info.GetReturnValue().Set(info.This()); }
+
+} // namespace
+
+v8::Local<v8::FunctionTemplate> Engine::getRangeIteratorClass() {
+    if (!rangeIteratorClass_.IsEmpty()) {
+        return rangeIteratorClass_.Get(isolate_);
+    }
+    auto ctor = v8::FunctionTemplate::New(isolate_);
+    ctor->SetClassName(ValueHelper::unwrap(intern("RangeIterator")));
+    ctor->InstanceTemplate()->SetInternalFieldCount(kRangeIteratorInternalField + 1);
+
+    auto proto = ctor->PrototypeTemplate();
+    proto->Set(
+        ValueHelper::unwrap(intern("next")),
+        v8::FunctionTemplate::New(isolate_, &rangeIteratorNext, {}, v8::Signature::New(isolate_, ctor))
+    );
+    proto->Set(v8::Symbol::GetIterator(isolate_), v8::FunctionTemplate::New(isolate_, &returnThis));
+
+    rangeIteratorClass_.Reset(isolate_, ctor);
+    return ctor;
+}
+
+namespace {
+
+// Stream 创建的异步迭代器在内部字段中持有的数据，仅在引擎线程访问
+struct StreamReaderHolder {
+    std::shared_ptr<bind::internal::StreamChannel> channel;
+    std::deque<v8::Global<v8::Promise::Resolver>>  pending; // 按调用顺序等待的 next()
+    v8::Global<v8::Array>                          batch;   // 已转换、尚未交给 Js 的元素
+    uint32_t                                       batchLength{0};
+    uint32_t                                       cursor{0};
+    bool                                           finished{false};
+
+    ~StreamReaderHolder() {
+        for (auto& resolver : pending) resolver.Reset();
+        channel->cancel();
+    }
+};
+
+constexpr int kStreamInternalField = 0;
+
+// 返回 false 表示 V8 无法完成 Promise (isolate 正在终止)，调用方应停止投递
+[[nodiscard]] bool settleFront(StreamReaderHolder& holder, v8::Local<v8::Value> value, bool reject) {
+    auto  isolate  = EngineScope::currentIsolateUnchecked(); // 仅在 V8 回调或 runPendingTasks 中调用
+    auto& ctx      = EngineScope::currentContextUnchecked();
+    auto  resolver = holder.pending.front().Get(isolate);
+    holder.pending.pop_front();
+    return (reject ? resolver->Reject(ctx, value) : resolver->Resolve(ctx, value)).IsJust();
+}
+
+// 依次满足挂起的 next()：先消耗已转换的批次，再从队列中取下一批；队列为空且未结束时等待生产者唤醒
+void deliverStream(StreamReaderHolder& holder) {
+    auto  isolate = EngineScope::currentIsolateUnchecked();
+    auto& ctx     = EngineScope::currentContextUnchecked();
+    while (!holder.pending.empty()) {
+        if (holder.cursor < holder.batchLength) {
+            auto value = holder.batch.Get(isolate)->Get(ctx, holder.cursor++).ToLocalChecked();
+            auto result = newIteratorResult(ValueHelper::wrap<Value>(value), false);
+            if (!settleFront(holder, ValueHelper::unwrap(result), false)) return;
+            continue;
+        }
+        if (!holder.finished) {
+            using State = bind::internal::StreamChannel::State;
+
+            std::vector<Local<Value>> values(holder.channel->batchSize());
+            auto                      state = State::Open;
+            std::string               error;
+            try {
+                auto count = holder.channel->take(values, state, error);
+                if (count > 0) {
+                    values.resize(count);
+                    holder.batch.Reset(isolate, ValueHelper::unwrap(Array::newArray(values)));
+                    holder.batchLength = static_cast<uint32_t>(count);
+                    holder.cursor      = 0;
+                    continue;
+                }
+            } catch (Exception const& e) {
+                // 元素转换失败：结束迭代并以该异常拒绝
+                holder.finished = true;
+                holder.channel->cancel();
+
+                v8::TryCatch vtry{isolate};
+                e.rethrowToRuntime();
+                if (!settleFront(holder, vtry.Exception(), true)) return;
+                continue;
+            }
+            if (state == State::Open) {
+                return;
+            }
+            holder.finished = true;
+            holder.batch.Reset();
+            if (state == State::Failed) {
+                auto exception = v8::Exception::Error(ValueHelper::unwrap(String::newString(error)));
+                if (!settleFront(holder, exception, true)) return;
+                continue;
+            }
+        }
+        if (!settleFront(holder, ValueHelper::unwrap(newIteratorResult({}, true)), false)) return;
+    }
+}
+
+StreamReaderHolder* getStreamReader(v8::Local<v8::Object> const& object) {
+    return static_cast<StreamReaderHolder*>(object->GetAlignedPointerFromInternalField(kStreamInternalField));
+}
+
+void streamNext(v8::FunctionCallbackInfo<v8::Value> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto holder   = getStreamReader(info.This()); // 接收者已由 Signature 校验
+    auto resolver = v8::Promise::Resolver::New(info.GetIsolate()->GetCurrentContext()).ToLocalChecked();
+    holder->pending.emplace_back(info.GetIsolate(), resolver);
+    deliverStream(*holder);
+    info.GetReturnValue().Set(resolver->GetPromise());
+}
+
+void streamReturn(v8::FunctionCallbackInfo<v8::Value> const& info) {
+    internal::CallbackScope scope{info.GetIsolate()};
+    auto holder   = getStreamReader(info.This());
+    auto ctx      = info.GetIsolate()->GetCurrentContext();
+    auto resolver = v8::Promise::Resolver::New(ctx).ToLocalChecked();
+
+    holder->finished    = true;
+    holder->batchLength = holder->cursor = 0;
+    holder->batch.Reset();
+    holder->channel->cancel();
+    deliverStream(*holder); // 结束所有挂起的 next()
+
+    if (resolver->Resolve(ctx, ValueHelper::unwrap(newIteratorResult({}, true))).IsNothing()) {
+        return; // isolate 正在终止
+    }
+    info.GetReturnValue().Set(resolver->GetPromise());
+}
+
+} // namespace
+
+v8::Local<v8::FunctionTemplate> Engine::getStreamClass() {
+    if (!streamClass_.IsEmpty()) {
+        return streamClass_.Get(isolate_);
+    }
+    auto ctor = v8::FunctionTemplate::New(isolate_);
+    ctor->SetClassName(ValueHelper::unwrap(intern("NativeStream")));
+    ctor->InstanceTemplate()->SetInternalFieldCount(kStreamInternalField + 1);
+
+    auto signature = v8::Signature::New(isolate_, ctor);
+    auto proto     = ctor->PrototypeTemplate();
+    proto->Set(ValueHelper::unwrap(intern("next")), v8::FunctionTemplate::New(isolate_, &streamNext, {}, signature));
+    proto->Set(
+        ValueHelper::unwrap(intern("return")),
+        v8::FunctionTemplate::New(isolate_, &streamReturn, {}, signature)
+    );
+    proto->Set(v8::Symbol::GetAsyncIterator(isolate_), v8::FunctionTemplate::New(isolate_, &returnThis));
+
+    streamClass_.Reset(isolate_, ctor);
+    return ctor;
+}
+
+void Engine::postTask(std::function<void()> task) {
+    std::lock_guard lock{pendingTasks_->mutex};
+    if (!pendingTasks_->closed) {
+        pendingTasks_->tasks.push_back(std::move(task));
+    }
+}
+
+size_t Engine::runPendingTasks() {
+    if (EngineScope::currentRuntime() != this) {
+        throw std::logic_error("Engine::runPendingTasks must be called inside the EngineScope of this engine");
+    }
+    std::vector<std::function<void()>> tasks;
+    {
+        std::lock_guard lock{pendingTasks_->mutex};
+        tasks.swap(pendingTasks_->tasks);
+    }
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        try {
+            tasks[i]();
+        } catch (...) {
+            std::lock_guard lock{pendingTasks_->mutex};
+            pendingTasks_->tasks.insert(
+                pendingTasks_->tasks.begin(),
+                std::make_move_iterator(tasks.begin() + static_cast<std::ptrdiff_t>(i) + 1),
+                std::make_move_iterator(tasks.end())
+            );
+            throw;
+        }
+    }
+    isolate_->PerformMicrotaskCheckpoint();
+    return tasks.size();
+}
+
+Local<String> Engine::internSlot(size_t slot, std::string_view str) {
+    if (slot >= internedSlots_.size()) {
+        internedSlots_.resize(slot + 1);
+    }
+    auto v8Str = newInternalizedString(isolate_, str);
+    internedSlots_[slot].Reset(isolate_, v8Str);
+    return ValueHelper::wrap<String>(v8Str);
+}
+
 void Engine::addManagedResource(void* resource, v8::Local<v8::Value> value, std::function<void(void*)>&& deleter) {
     auto managed = std::make_unique<ManagedResource>(this, resource, std::move(deleter));
 
@@ -147,14 +871,15 @@ void Engine::addManagedResource(void* resource, v8::Local<v8::Value> value, std:
             auto managed = static_cast<ManagedResource*>(data.GetParameter());
             auto runtime = managed->runtime;
             {
-                v8::Locker locker(runtime->isolate_); // Since the v8 GC is not on the same thread, locking is required
-                auto       iter = runtime->managedResources_.find(managed);
+                // Since the v8 GC is not on the same thread, locking is required
+                internal::EngineLocker locker(*runtime);
+                auto                   iter = runtime->managedResources_.find(managed);
                 assert(iter != runtime->managedResources_.end()); // ManagedResource should be in the map
                 runtime->managedResources_.erase(iter);
 
                 data.SetSecondPassCallback([](v8::WeakCallbackInfo<void> const& data) {
-                    auto       managed = static_cast<ManagedResource*>(data.GetParameter());
-                    v8::Locker locker(managed->runtime->isolate_);
+                    auto                   managed = static_cast<ManagedResource*>(data.GetParameter());
+                    internal::EngineLocker locker(*managed->runtime);
                     delete managed;
                 });
             }
@@ -166,7 +891,7 @@ void Engine::addManagedResource(void* resource, v8::Local<v8::Value> value, std:
 
 void Engine::registerClass(bind::meta::ClassDefine const& binding) {
     if (registeredClasses_.contains(binding.name_)) {
-        throw Exception("Class binding already registered: " + binding.name_);
+        throw Exception("Class binding already registered: " + std::string{binding.name_});
     }
 
     v8::TryCatch vtry(isolate_);
@@ -186,20 +911,20 @@ void Engine::registerClass(bind::meta::ClassDefine const& binding) {
         ctor->RemovePrototype();
     }
 
-    auto scriptClassName = String::newString(binding.name_);
+    auto scriptClassName = intern(binding.name_);
     ctor->SetClassName(ValueHelper::unwrap(scriptClassName));
 
     if (binding.base_ != nullptr) {
         if (!binding.base_->hasConstructor()) {
             throw Exception{
-                binding.name_ + " cannot inherit from " + binding.base_->name_
+                std::string{binding.name_} + " cannot inherit from " + std::string{binding.base_->name_}
                 + " because it is a static class without a prototype."
             };
         }
         auto iter = classConstructors_.find(binding.base_);
         if (iter == classConstructors_.end()) {
             throw Exception{
-                binding.name_ + " cannot inherit from " + binding.base_->name_
+                std::string{binding.name_} + " cannot inherit from " + std::string{binding.base_->name_}
                 + " because the parent class is not registered."
             };
         }
@@ -227,9 +952,11 @@ void Engine::implStaticRegister(
     bind::meta::StaticMemberDefine const& staticBinding
 ) {
     for (auto& property : staticBinding.property_) {
-        auto scriptPropertyName = String::newString(property.name_);
+        auto scriptPropertyName = intern(property.name_);
 
         auto v8Getter = [](v8::Local<v8::Name>, v8::PropertyCallbackInfo<v8::Value> const& info) {
+            internal::CallbackScope scope{info.GetIsolate()};
+
             auto pbin = static_cast<bind::meta::StaticMemberDefine::Property*>(info.Data().As<v8::External>()->Value());
             try {
                 auto ret = pbin->getter_();
@@ -242,6 +969,8 @@ void Engine::implStaticRegister(
         v8::AccessorNameSetterCallback v8Setter = nullptr;
         if (property.setter_) {
             v8Setter = [](v8::Local<v8::Name>, v8::Local<v8::Value> value, v8::PropertyCallbackInfo<void> const& info) {
+                internal::CallbackScope scope{info.GetIsolate()};
+
                 auto pbin =
                     static_cast<bind::meta::StaticMemberDefine::Property*>(info.Data().As<v8::External>()->Value());
                 try {
@@ -251,7 +980,8 @@ void Engine::implStaticRegister(
                 }
             };
         } else {
-            v8Setter = [](v8::Local<v8::Name>, v8::Local<v8::Value>, v8::PropertyCallbackInfo<void> const&) {
+            v8Setter = [](v8::Local<v8::Name>, v8::Local<v8::Value>, v8::PropertyCallbackInfo<void> const& info) {
+                internal::CallbackScope scope{info.GetIsolate()};
                 Exception(
                     "Native property have only one getter, and you cannot modify native property without "
                     "getters",
@@ -270,63 +1000,48 @@ void Engine::implStaticRegister(
         );
     }
     for (auto& function : staticBinding.functions_) {
-        auto scriptFunctionName = String::newString(function.name_);
+        auto scriptFunctionName = intern(function.name_);
+
+        v8::FunctionCallback callback = function.trampoline_; // 编译期生成的回调优先
+        if (callback == nullptr) {
+            callback = [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+                internal::CallbackScope scope{info.GetIsolate()};
 
-        auto fn = v8::FunctionTemplate::New(
-            isolate_,
-            [](v8::FunctionCallbackInfo<v8::Value> const& info) {
                 auto fbin =
                     static_cast<bind::meta::StaticMemberDefine::Function*>(info.Data().As<v8::External>()->Value());
 
                 try {
-                    auto ret = (fbin->callback_)(Arguments{EngineScope::currentRuntime(), info});
+                    auto ret = (fbin->callback_)(Arguments{scope.runtime(), info});
                     info.GetReturnValue().Set(ValueHelper::unwrap(ret));
                 } catch (Exception const& e) {
                     e.rethrowToRuntime();
                 }
-            },
+            };
+        }
+        auto fn = v8::FunctionTemplate::New(
+            isolate_,
+            callback,
             v8::External::New(isolate_, const_cast<bind::meta::StaticMemberDefine::Function*>(&function)),
             {},
             0,
-            v8::ConstructorBehavior::kThrow
+            v8::ConstructorBehavior::kThrow,
+            v8::SideEffectType::kHasSideEffect,
+            function.fastCallback_.valid() ? &function.fastCallback_.function_ : nullptr
         );
         ctor->Set(ValueHelper::unwrap(scriptFunctionName).As<v8::Name>(), fn, v8::PropertyAttribute::DontDelete);
     }
 }
 
-constexpr int kCtorExternal_ClassBinding = 0;
-constexpr int kCtorExternal_JsRuntime    = 1;
-
 v8::Local<v8::FunctionTemplate> Engine::createInstanceClassCtor(bind::meta::ClassDefine const& binding) {
-    v8::TryCatch vtry{isolate_};
-
-    v8::Local<v8::Object> data = v8::Object::New(isolate_);
-    Exception::rethrow(vtry);
-
-    auto ctx = context_.Get(isolate_);
-
-    (void)data->Set(
-        ctx,
-        kCtorExternal_ClassBinding,
-        v8::External::New(isolate_, const_cast<bind::meta::ClassDefine*>(&binding))
-    );
-    Exception::rethrow(vtry);
-
-    (void)data->Set(ctx, kCtorExternal_JsRuntime, v8::External::New(isolate_, this));
-    Exception::rethrow(vtry);
+    auto data = v8::External::New(isolate_, const_cast<bind::meta::ClassDefine*>(&binding));
 
     auto ctor = v8::FunctionTemplate::New(
         isolate_,
         [](v8::FunctionCallbackInfo<v8::Value> const& info) {
-            auto ctx  = info.GetIsolate()->GetCurrentContext();
-            auto data = info.Data().As<v8::Object>();
+            internal::CallbackScope scope{info.GetIsolate()};
 
-            auto binding = static_cast<bind::meta::ClassDefine*>(
-                data->Get(ctx, kCtorExternal_ClassBinding).ToLocalChecked().As<v8::External>()->Value()
-            );
-            auto runtime = static_cast<Engine*>(
-                data->Get(ctx, kCtorExternal_JsRuntime).ToLocalChecked().As<v8::External>()->Value()
-            );
+            auto binding = static_cast<bind::meta::ClassDefine*>(info.Data().As<v8::External>()->Value());
+            auto runtime = scope.runtime(); // Engine 从 isolate 数据槽获取，不再经由 data 对象的属性读取
 
             auto& ctor = binding->instanceMemberDef_.constructor_;
 
@@ -335,53 +1050,12 @@ v8::Local<v8::FunctionTemplate> Engine::createInstanceClassCtor(bind::meta::Clas
                     throw Exception{"Native class constructor cannot be called as a function"};
                 }
 
-                void* instance        = nullptr;
-                bool  constructFromJs = true;
-                if (info.Length() == 2 && info[0]->IsSymbol()
-                    && info[0]->StrictEquals(runtime->constructorSymbol_.Get(runtime->isolate_))
-                    && info[1]->IsExternal()) {
-                    // constructor call from native code
-                    instance        = info[1].As<v8::External>()->Value();
-                    constructFromJs = false;
-                } else {
-                    // constructor call from JS code
-                    instance = ctor(Arguments{runtime, info});
-                }
-
+                void* instance = ctor(Arguments{runtime, info});
                 if (instance == nullptr) {
-                    if (constructFromJs) {
-                        throw Exception{"This native class cannot be constructed."};
-                    } else {
-                        throw Exception{"This native class cannot be constructed from native code."};
-                    }
-                }
-
-                void* wrapped = constructFromJs ? binding->manage(instance).release() : instance;
-                {
-                    auto typed     = static_cast<bind::JsManagedResource*>(wrapped);
-                    typed->define_ = const_cast<bind::meta::ClassDefine*>(binding);
-                    typed->engine_ = runtime;
-
-                    (*const_cast<bool*>(&typed->constructFromJs_)) = constructFromJs;
+                    throw Exception{"This native class cannot be constructed."};
                 }
-                info.This()->SetAlignedPointerInInternalField(kInternalField_WrappedResource, wrapped);
 
-                if (constructFromJs) {
-                    runtime->isolate_->AdjustAmountOfExternalAllocatedMemory(
-                        static_cast<int64_t>(binding->instanceMemberDef_.classSize_)
-                    );
-                }
-
-                runtime->addManagedResource(wrapped, info.This(), [](void* wrapped) {
-                    auto typed = static_cast<bind::JsManagedResource*>(wrapped);
-
-                    if (typed->constructFromJs_) {
-                        typed->engine_->isolate_->AdjustAmountOfExternalAllocatedMemory(
-                            -static_cast<int64_t>(typed->define_->instanceMemberDef_.classSize_)
-                        );
-                    }
-                    delete typed;
-                });
+                runtime->attachNativeInstance(info.This(), *binding, binding->manage(instance).release(), true);
             } catch (Exception const& e) {
                 e.rethrowToRuntime();
             }
@@ -401,11 +1075,13 @@ void Engine::implInstanceRegister(
     auto signature = v8::Signature::New(isolate_);
 
     for (auto& method : instanceBinding.methods_) {
-        auto scriptMethodName = String::newString(method.name_);
+        auto scriptMethodName = intern(method.name_);
+
+        v8::FunctionCallback callback = method.trampoline_; // 编译期生成的回调优先
+        if (callback == nullptr) {
+            callback = [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+                internal::CallbackScope scope{info.GetIsolate()};
 
-        auto fn = v8::FunctionTemplate::New(
-            isolate_,
-            [](v8::FunctionCallbackInfo<v8::Value> const& info) {
                 auto method =
                     static_cast<bind::meta::InstanceMemberDefine::Method*>(info.Data().As<v8::External>()->Value());
                 auto wrapped = info.This()->GetAlignedPointerFromInternalField(kInternalField_WrappedResource);
@@ -423,22 +1099,33 @@ void Engine::implInstanceRegister(
                 } catch (Exception const& e) {
                     e.rethrowToRuntime();
                 }
-            },
+            };
+        }
+        auto fn = v8::FunctionTemplate::New(
+            isolate_,
+            callback,
             v8::External::New(isolate_, const_cast<bind::meta::InstanceMemberDefine::Method*>(&method)),
-            signature
+            signature,
+            0,
+            // Fast API 回调不支持构造函数
+            method.fastCallback_.valid() ? v8::ConstructorBehavior::kThrow : v8::ConstructorBehavior::kAllow,
+            v8::SideEffectType::kHasSideEffect,
+            method.fastCallback_.valid() ? &method.fastCallback_.function_ : nullptr
         );
         prototype->Set(ValueHelper::unwrap(scriptMethodName), fn, v8::PropertyAttribute::DontDelete);
     }
 
     for (auto& prop : instanceBinding.property_) {
-        auto scriptPropertyName = String::newString(prop.name_);
+        auto scriptPropertyName = intern(prop.name_);
         auto data = v8::External::New(isolate_, const_cast<bind::meta::InstanceMemberDefine::Property*>(&prop));
         v8::Local<v8::FunctionTemplate> v8Getter;
         v8::Local<v8::FunctionTemplate> v8Setter;
 
-        v8Getter = v8::FunctionTemplate::New(
-            isolate_,
-            [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+        v8::FunctionCallback getter = prop.getterTrampoline_; // 编译期生成的回调优先
+        if (getter == nullptr) {
+            getter = [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+                internal::CallbackScope scope{info.GetIsolate()};
+
                 auto prop =
                     static_cast<bind::meta::InstanceMemberDefine::Property*>(info.Data().As<v8::External>()->Value());
                 auto wrapped = info.This()->GetAlignedPointerFromInternalField(kInternalField_WrappedResource);
@@ -456,15 +1143,16 @@ void Engine::implInstanceRegister(
                 } catch (Exception const& e) {
                     e.rethrowToRuntime();
                 }
-            },
-            data,
-            signature
-        );
+            };
+        }
+        v8Getter = v8::FunctionTemplate::New(isolate_, getter, data, signature);
 
         if (prop.setter_) {
-            v8Setter = v8::FunctionTemplate::New(
-                isolate_,
-                [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+            v8::FunctionCallback setter = prop.setterTrampoline_;
+            if (setter == nullptr) {
+                setter = [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+                    internal::CallbackScope scope{info.GetIsolate()};
+
                     auto prop = static_cast<bind::meta::InstanceMemberDefine::Property*>(
                         info.Data().As<v8::External>()->Value()
                     );
@@ -482,10 +1170,9 @@ void Engine::implInstanceRegister(
                     } catch (Exception const& e) {
                         e.rethrowToRuntime();
                     }
-                },
-                data,
-                signature
-            );
+                };
+            }
+            v8Setter = v8::FunctionTemplate::New(isolate_, setter, data, signature);
         }
 
         prototype->SetAccessorProperty(
@@ -497,28 +1184,83 @@ void Engine::implInstanceRegister(
     }
 }
 
-Local<Object>
-Engine::newInstance(bind::meta::ClassDefine const& bind, std::unique_ptr<bind::JsManagedResource>&& wrappedResource) {
+void Engine::attachNativeInstance(
+    v8::Local<v8::Object> const&   object,
+    bind::meta::ClassDefine const& binding,
+    bind::JsManagedResource*       wrapped,
+    bool                           constructFromJs
+) {
+    wrapped->define_                                 = &binding;
+    wrapped->engine_                                 = this;
+    (*const_cast<bool*>(&wrapped->constructFromJs_)) = constructFromJs;
+
+    object->SetAlignedPointerInInternalField(kInternalField_WrappedResource, wrapped);
+
+    if (constructFromJs) {
+        isolate_->AdjustAmountOfExternalAllocatedMemory(static_cast<int64_t>(binding.instanceMemberDef_.classSize_));
+    }
+
+    addManagedResource(wrapped, object, [](void* wrapped) {
+        auto typed = static_cast<bind::JsManagedResource*>(wrapped);
+
+        if (typed->constructFromJs_) {
+            typed->engine_->isolate_->AdjustAmountOfExternalAllocatedMemory(
+                -static_cast<int64_t>(typed->define_->instanceMemberDef_.classSize_)
+            );
+        }
+        delete typed;
+    });
+}
+
+v8::Local<v8::ObjectTemplate> Engine::getInstanceTemplate(bind::meta::ClassDefine const& bind) const {
     auto iter = classConstructors_.find(&bind);
     if (iter == classConstructors_.end()) {
-        throw Exception{"The native class " + bind.name_ + " is not registered, so an instance cannot be constructed."};
+        throw Exception{
+            "The native class " + std::string{bind.name_} + " is not registered, so an instance cannot be constructed."
+        };
     }
+    return iter->second.Get(isolate_)->InstanceTemplate();
+}
+
+Local<Object>
+Engine::newInstance(bind::meta::ClassDefine const& bind, std::unique_ptr<bind::JsManagedResource>&& wrappedResource) {
+    auto templ = getInstanceTemplate(bind);
 
     v8::TryCatch vtry{isolate_};
 
-    auto ctx  = context_.Get(isolate_);
-    auto ctor = iter->second.Get(isolate_)->GetFunction(ctx);
+    // Instantiate directly from the InstanceTemplate, the JS constructor callback is not involved.
+    auto maybe = templ->NewInstance(context_.Get(isolate_));
     Exception::rethrow(vtry);
 
-    // (symbol, instance)
-    auto args = std::vector<v8::Local<v8::Value>>{
-        constructorSymbol_.Get(isolate_).As<v8::Value>(),
-        v8::External::New(isolate_, wrappedResource.release())
-    };
-    auto val = ctor.ToLocalChecked()->NewInstance(ctx, static_cast<int>(args.size()), args.data());
-    Exception::rethrow(vtry);
+    auto object = maybe.ToLocalChecked();
+    attachNativeInstance(object, bind, wrappedResource.release(), false);
+    return ValueHelper::wrap<Object>(object);
+}
+
+Local<Array> Engine::newInstances(
+    bind::meta::ClassDefine const&                      bind,
+    std::span<std::unique_ptr<bind::JsManagedResource>> wrappedResources
+) {
+    internal::V8EscapeScope scope{isolate_};
+
+    auto templ = getInstanceTemplate(bind);
+    auto ctx   = context_.Get(isolate_);
+
+    v8::TryCatch vtry{isolate_};
+
+    std::vector<v8::Local<v8::Value>> elements;
+    elements.reserve(wrappedResources.size());
+    for (auto& wrapped : wrappedResources) {
+        auto maybe = templ->NewInstance(ctx);
+        Exception::rethrow(vtry);
+
+        auto object = maybe.ToLocalChecked();
+        attachNativeInstance(object, bind, wrapped.release(), false);
+        elements.push_back(object);
+    }
 
-    return ValueHelper::wrap<Object>(val.ToLocalChecked());
+    auto array = v8::Array::New(isolate_, elements.data(), elements.size());
+    return ValueHelper::wrap<Array>(scope.escape(array));
 }
 
 bool Engine::isInstanceOf(Local<Object> const& obj, bind::meta::ClassDefine const& binding) const {
@@ -542,4 +1284,203 @@ void* Engine::getNativeInstanceOf(Local<Object> const& obj) const {
 
 void Engine::gc() const { isolate_->LowMemoryNotification(); }
 
-} // namespace v8wrap
\ No newline at end of file
+namespace bind::internal {
+
+size_t StructShapeCache::nextSlot() noexcept {
+    static std::atomic<size_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+Local<Object> StructShapeCache::newObject(
+    size_t                            slot,
+    std::span<std::string_view const> names,
+    std::span<Local<Value> const>     values
+) {
+    auto& engine  = EngineScope::currentRuntimeChecked();
+    auto  isolate = engine.isolate_;
+    auto  ctx     = engine.context();
+    auto& shape   = engine.getStructShape(slot, names);
+
+    v8::TryCatch vtry{isolate};
+
+    auto maybe = shape.template_.Get(isolate)->NewInstance(ctx);
+    Exception::rethrow(vtry);
+    auto object = maybe.ToLocalChecked();
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        auto key = shape.keys_[i].Get(isolate);
+        if (object->CreateDataProperty(ctx, key, ValueHelper::unwrap(values[i])).IsNothing()) [[unlikely]] {
+            Exception::rethrow(vtry);
+            throw Exception{"V8 operation failed without an exception"};
+        }
+    }
+    return ValueHelper::wrap<Object>(object);
+}
+
+void StructShapeCache::readObject(
+    size_t                            slot,
+    std::span<std::string_view const> names,
+    Local<Object> const&              object,
+    std::span<Local<Value>>           values
+) {
+    auto& engine  = EngineScope::currentRuntimeChecked();
+    auto  isolate = engine.isolate_;
+    auto  ctx     = engine.context();
+    auto& shape   = engine.getStructShape(slot, names);
+    auto  v8Obj   = ValueHelper::unwrap(object);
+
+    v8::TryCatch vtry{isolate};
+    for (size_t i = 0; i < values.size(); ++i) {
+        auto maybe = v8Obj->Get(ctx, shape.keys_[i].Get(isolate));
+        Exception::rethrow(vtry);
+        values[i] = ValueHelper::wrap<Value>(maybe.ToLocalChecked());
+    }
+}
+
+Local<Object> LazyObjectDefine::newObject(std::shared_ptr<void const> value) const {
+    auto& engine = EngineScope::currentRuntimeChecked();
+    auto  tmpl   = engine.getLazyObjectTemplate(*this);
+
+    v8::TryCatch vtry{engine.isolate_};
+
+    auto maybe = tmpl->NewInstance(engine.context());
+    Exception::rethrow(vtry);
+    auto object = maybe.ToLocalChecked();
+
+    if (getEntry_ != nullptr) {
+        // kNonMasking 拦截器只在原型链未命中时调用，键值容器不继承 Object.prototype，避免 "constructor" 等键被遮蔽
+        if (object->SetPrototype(engine.context(), v8::Null(engine.isolate_)).IsNothing()) [[unlikely]] {
+            Exception::rethrow(vtry);
+            throw Exception{"V8 operation failed without an exception"};
+        }
+    }
+
+    auto lazy = new LazyObject{this, std::move(value)};
+    object->SetAlignedPointerInInternalField(kLazyObjectInternalField, lazy);
+    engine.addManagedResource(lazy, object, [](void* lazy) { delete static_cast<LazyObject*>(lazy); });
+    return ValueHelper::wrap<Object>(object);
+}
+
+Local<Object> LiveContainerDefine::newObject(void* container, Local<Value> const& owner) const {
+    auto& engine  = EngineScope::currentRuntimeChecked();
+    auto  isolate = engine.isolate_;
+    auto  ctx     = engine.context();
+    auto  tmpl    = engine.getLiveContainerTemplate(*this);
+
+    v8::TryCatch vtry{isolate};
+
+    auto maybe = tmpl->NewInstance(ctx);
+    Exception::rethrow(vtry);
+    auto object = maybe.ToLocalChecked();
+
+    if (size_ != nullptr) {
+        // 数组型容器可直接使用 Array.prototype 上的方法 (map/forEach/...)
+        if (object->SetPrototype(ctx, v8::Array::New(isolate)->GetPrototype()).IsNothing()) [[unlikely]] {
+            Exception::rethrow(vtry);
+            throw Exception{"V8 operation failed without an exception"};
+        }
+    }
+
+    auto live = new LiveContainerHolder{this, container, {}};
+    if (!owner.isUndefined()) {
+        live->owner.Reset(isolate, ValueHelper::unwrap(owner));
+    }
+    object->SetAlignedPointerInInternalField(kLiveContainerInternalField, live);
+    engine.addManagedResource(live, object, [](void* live) { delete static_cast<LiveContainerHolder*>(live); });
+    return ValueHelper::wrap<Object>(object);
+}
+
+Local<Object> RangeIteratorDefine::newObject(void* state, uint32_t batchSize) const {
+    auto& engine = EngineScope::currentRuntimeChecked();
+    auto  holder = std::make_unique<RangeIteratorHolder>(this, state, batchSize);
+
+    v8::TryCatch vtry{engine.isolate_};
+
+    auto maybe = engine.getRangeIteratorClass()->InstanceTemplate()->NewInstance(engine.context());
+    Exception::rethrow(vtry);
+    auto object = maybe.ToLocalChecked();
+
+    object->SetAlignedPointerInInternalField(kRangeIteratorInternalField, holder.get());
+    engine.addManagedResource(holder.release(), object, [](void* holder) {
+        delete static_cast<RangeIteratorHolder*>(holder);
+    });
+    return ValueHelper::wrap<Object>(object);
+}
+
+
+Local<Object> StreamChannel::newObject() {
+    auto& engine = EngineScope::currentRuntimeChecked();
+    if (reader_ != nullptr || cancelled()) [[unlikely]] {
+        throw Exception{"Stream has already been consumed", Exception::Type::TypeError};
+    }
+    auto holder = std::make_unique<StreamReaderHolder>(shared_from_this());
+
+    v8::TryCatch vtry{engine.isolate_};
+
+    auto maybe = engine.getStreamClass()->InstanceTemplate()->NewInstance(engine.context());
+    Exception::rethrow(vtry);
+    auto object = maybe.ToLocalChecked();
+
+    object->SetAlignedPointerInInternalField(kStreamInternalField, holder.get());
+    {
+        std::lock_guard lock{mutex_};
+        engine_ = &engine;
+        reader_ = holder.get();
+    }
+    engine.addManagedResource(holder.release(), object, [](void* holder) {
+        delete static_cast<StreamReaderHolder*>(holder);
+    });
+    return ValueHelper::wrap<Object>(object);
+}
+
+size_t StreamChannel::take(std::span<Local<Value>> out, State& state, std::string& error) {
+    size_t count = 0;
+    {
+        std::lock_guard lock{mutex_};
+        count = takeLocked(out.size());
+        if (count == 0) {
+            if (failed_ && !cancelled_) {
+                state = State::Failed;
+                error = error_;
+            } else if (closed_ || cancelled_) {
+                state = State::Closed;
+            } else {
+                state          = State::Open;
+                readerWaiting_ = true;
+            }
+            return 0;
+        }
+    }
+    writable_.notify_all();
+    convertTaken(out.first(count));
+    return count;
+}
+
+void StreamChannel::cancel() {
+    {
+        std::lock_guard lock{mutex_};
+        cancelled_     = true;
+        readerWaiting_ = false;
+        engine_        = nullptr;
+        reader_        = nullptr;
+        clearLocked();
+    }
+    writable_.notify_all();
+}
+
+void StreamChannel::notifyReadable() {
+    if (!readerWaiting_ || engine_ == nullptr) {
+        return;
+    }
+    readerWaiting_ = false;
+    // 持有锁投递：cancel() 同样需要此锁，保证投递时 Engine 尚未析构
+    engine_->postTask([self = shared_from_this()] {
+        if (self->reader_ != nullptr) {
+            deliverStream(*static_cast<StreamReaderHolder*>(self->reader_));
+        }
+    });
+}
+
+} // namespace bind::internal
+
+} // namespace v8wrap
@@ -6,11 +6,20 @@
 #include "v8wrap/concepts/BasicConcepts.h"
 #include "v8wrap/reference/Local.h"
 #include "v8wrap/types/Value.h"
+#include "v8wrap/types/internal/StringHelper.h"
 
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 
 V8_WRAP_WARNING_GUARD_BEGIN
@@ -26,20 +35,33 @@ namespace v8wrap {
 
 namespace internal {
 class V8EscapeScope;
-}
+class EngineLocker;
+} // namespace internal
+namespace bind::internal {
+struct StructShapeCache;
+struct LazyObjectDefine;
+struct LiveContainerDefine;
+struct RangeIteratorDefine;
+class StreamChannel;
+} // namespace bind::internal
 
 class Platform;
 
 
 class Engine final {
 public:
-    V8WRAP_DISALLOW_COPY(Engine);
-
-    Engine(Engine&&) noexcept            = default;
-    Engine& operator=(Engine&&) noexcept = default;
+    // isolate 数据槽、context 嵌入数据与托管资源均保存 Engine 的地址，因此不可移动
+    V8WRAP_DISALLOW_COPY_AND_MOVE(Engine);
 
     ~Engine();
 
+    /**
+     * 线程模式
+     * - MultiThreaded: EngineScope 通过 v8::Locker 加锁，Engine 可在多个线程间交替使用
+     * - SingleThreaded: Engine 仅在创建它的线程中使用，EngineScope 不再加锁；在其他线程进入会抛出 std::logic_error
+     */
+    enum class ThreadMode { MultiThreaded, SingleThreaded };
+
     /**
      * 创建一个 Js 引擎
      * @note 此重载依赖全局的 Platform，请确保 Platform 已初始化
@@ -47,17 +69,23 @@ public:
      * @note Engine 的构造函数不会访问 Platform，所以您需要手动调用 Platform::addEngine
      * @note 综上，建议直接从 Platform::newEngine 创建实例而非手动 new Engine / make_unique<Engine>
      */
-    explicit Engine();
+    explicit Engine(ThreadMode mode = ThreadMode::MultiThreaded);
 
     /**
      * To create a Js engine, using sources from outside is isolate and context.
      * This overload is commonly used in NodeJs Addons.
      * When using isolate and contexts from outside (e.g. NodeJs), the Platform is not required.
      */
-    explicit Engine(v8::Isolate* isolate, v8::Local<v8::Context> context);
+    explicit Engine(
+        v8::Isolate*           isolate,
+        v8::Local<v8::Context> context,
+        ThreadMode             mode = ThreadMode::MultiThreaded
+    );
 
     [[nodiscard]] v8::Isolate* isolate() const;
 
+    [[nodiscard]] bool isSingleThreaded() const;
+
     [[nodiscard]] v8::Local<v8::Context> context() const;
 
     void setData(std::shared_ptr<void> data);
@@ -81,8 +109,25 @@ public:
 
     [[nodiscard]] Local<Value> getVauleFromGlobalThis(Local<String> const& key) const;
 
+    [[nodiscard]] Local<Value> getVauleFromGlobalThis(std::string_view key);
+
     void setVauleToGlobalThis(Local<String> const& key, Local<Value> const& value) const;
 
+    void setVauleToGlobalThis(std::string_view key, Local<Value> const& value);
+
+    /**
+     * 获取内部化(internalized)的字符串，结果在 Engine 内缓存，重复获取同名字符串无需再次创建与哈希
+     * @note 适用于属性名等数量有限的热点字符串；缓存条目超过 kMaxInternedStrings 后不再缓存新字符串
+     */
+    [[nodiscard]] Local<String> intern(std::string_view str);
+
+    /**
+     * 编译期字面量版本，按字面量分配固定槽位，查找无需哈希
+     * @code engine.intern<"position">()
+     */
+    template <internal::FixedString Str>
+    [[nodiscard]] inline Local<String> intern();
+
     /**
      * Add a managed resource to the runtime.
      * The managed resource will be destroyed when the runtime is destroyed.
@@ -92,6 +137,20 @@ public:
      */
     void addManagedResource(void* resource, v8::Local<v8::Value> value, std::function<void(void*)>&& deleter);
 
+    /**
+     * 投递任务到引擎线程，可在任意线程调用
+     * @note 任务不会自动执行，需由嵌入方在引擎线程的事件循环中调用 runPendingTasks
+     * @note Engine 开始销毁后投递的任务会被丢弃
+     */
+    void postTask(std::function<void()> task);
+
+    /**
+     * 执行已投递的任务，随后执行微任务检查点 (Promise 回调等)
+     * @note 需在 EngineScope 内调用；任务抛出异常时，其后的任务保留到下次执行
+     * @return 执行的任务数量
+     */
+    size_t runPendingTasks();
+
     /**
      * Register a binding class and mount it to globalThis
      */
@@ -113,10 +172,21 @@ public:
     /**
      * 创建一个新的 JavaScript 类实例
      * Creates a new JavaScript class instance.
+     * @note 实例直接由 InstanceTemplate 创建，不会调用 Js 构造函数
      */
     Local<Object>
     newInstance(bind::meta::ClassDefine const& bind, std::unique_ptr<bind::JsManagedResource>&& wrappedResource);
 
+    /**
+     * 批量创建 JavaScript 类实例，返回包含所有实例的数组
+     * Creates JavaScript class instances in bulk and returns them as an array.
+     * @note 调用后 wrappedResources 中的资源所有权均转移给 v8wrap
+     */
+    Local<Array> newInstances(
+        bind::meta::ClassDefine const&                      bind,
+        std::span<std::unique_ptr<bind::JsManagedResource>> wrappedResources
+    );
+
     /**
      * 创建一个新的 JavaScript 类实例
      * @warning C++实例必须分配在堆上(使用 `new` 操作符), 栈分配的实例会导致悬垂引用和 GC 崩溃。
@@ -125,6 +195,13 @@ public:
     template <typename T>
     Local<Object> newInstanceOfRaw(bind::meta::ClassDefine const& bind, T* instance);
 
+    /**
+     * 批量创建 JavaScript 类实例 (newInstanceOfRaw)
+     * @note v8wrap 会接管所有实例的生命周期，GC 时自动销毁
+     */
+    template <typename T>
+    Local<Array> newInstancesOfRaw(bind::meta::ClassDefine const& bind, std::span<T* const> instances);
+
     /**
      * 创建一个新的 JavaScript 类实例
      * @note v8wrap 不接管实例的生命周期，由外部管理实例的生命周期 (不自动销毁)
@@ -132,6 +209,13 @@ public:
     template <typename T>
     Local<Object> newInstanceOfView(bind::meta::ClassDefine const& bind, T* instance);
 
+    /**
+     * 批量创建 JavaScript 类实例 (newInstanceOfView)
+     * @note v8wrap 不接管实例的生命周期，由外部管理实例的生命周期 (不自动销毁)
+     */
+    template <typename T>
+    Local<Array> newInstancesOfView(bind::meta::ClassDefine const& bind, std::span<T* const> instances);
+
     /**
      * 创建一个新的 JavaScript 类实例
      * @note v8wrap 不接管实例的生命周期，对子资源创建 Global 引用关联生命周期(常见于对类成员创建Js实例，防止主实例 GC)
@@ -167,6 +251,23 @@ public:
     template <typename T>
     [[nodiscard]] inline T* getNativeInstanceOf(Local<Object> const& obj) const;
 
+    /**
+     * 从绑定类实例的内部字段取出托管资源，不进行任何类型检查
+     * @note 仅供内部快速路径使用 (例如 Fast API 回调)，调用方需保证 obj 是绑定类的实例
+     */
+    [[nodiscard]] inline static bind::JsManagedResource* getManagedResourceUnchecked(v8::Local<v8::Object> const& obj);
+
+    /**
+     * 获取 isolate 上当前的 Engine，不依赖 EngineScope
+     * - isolate 只被一个 Engine 使用时，直接读取 isolate 数据槽
+     * - 多个 Engine 共享 isolate 时 (例如 Node 插件中创建多个 Engine)，读取当前 context 的嵌入数据
+     * - 数据槽已被嵌入方占用时不覆盖其数据，同样读取当前 context 的嵌入数据
+     * @note 供 V8 回调使用；isolate 上没有 Engine 或当前 context 不属于任何 Engine 时返回 nullptr
+     */
+    [[nodiscard]] inline static Engine* fromIsolate(v8::Isolate* isolate);
+
+    [[nodiscard]] static Engine* fromContext(v8::Local<v8::Context> const& context);
+
     void gc() const;
 
 private:
@@ -182,15 +283,37 @@ private:
         bind::meta::InstanceMemberDefine const& instanceBinding
     );
 
+    [[nodiscard]] v8::Local<v8::ObjectTemplate> getInstanceTemplate(bind::meta::ClassDefine const& bind) const;
+
+    // 全局递增的字面量槽位编号，所有 Engine 共享同一编号
+    static size_t nextInternSlot() noexcept;
+
+    Local<String> internSlot(size_t slot, std::string_view str);
+
+    // 关联原生资源与 Js 对象，并交由 Engine 托管
+    void attachNativeInstance(
+        v8::Local<v8::Object> const&   object,
+        bind::meta::ClassDefine const& binding,
+        bind::JsManagedResource*       wrapped,
+        bool                           constructFromJs
+    );
+
     friend class EngineScope;
     friend class ExitEngineScope;
     friend class internal::V8EscapeScope;
+    friend class internal::EngineLocker;
 
     template <typename>
     friend class Global;
     template <typename>
     friend class Weak;
 
+    friend struct bind::internal::StructShapeCache;
+    friend struct bind::internal::LazyObjectDefine;
+    friend struct bind::internal::LiveContainerDefine;
+    friend struct bind::internal::RangeIteratorDefine;
+    friend class bind::internal::StreamChannel;
+
     struct ManagedResource {
         Engine*                    runtime;
         void*                      resource;
@@ -201,19 +324,70 @@ private:
     static constexpr int kInternalFieldCount            = 1;
     static constexpr int kInternalField_WrappedResource = 0;
 
+    static constexpr size_t kMaxInternedStrings = 4096;
+
+    static constexpr uint32_t kIsolateDataSlot         = V8WRAP_ISOLATE_DATA_SLOT;
+    static constexpr int      kContextEmbedderDataIndex = V8WRAP_CONTEXT_EMBEDDER_DATA_INDEX;
+
+    // isolate 数据槽中的标记：isolate 被多个 Engine 共享，需要按 context 查找
+    inline static char const kSharedIsolateTag{};
+
+    // 某个 isolate 的数据槽已被嵌入方占用 (既不是 Engine 也不是共享标记)，此后 fromIsolate 一律按 context 查找
+    inline static std::atomic_bool foreignIsolateData_{false};
+
+    void attachToIsolate(v8::Local<v8::Context> const& context);
+
+    void detachFromIsolate();
+
     v8::Isolate*            isolate_{nullptr};
     v8::Global<v8::Context> context_{};
     std::shared_ptr<void>   userData_{nullptr};
 
-    bool       isDestroying_{false};
-    bool const isExternalIsolate_{false};
-
-    // This symbol is used to mark the construction of objects from C++ (with special logic).
-    v8::Global<v8::Symbol> constructorSymbol_{};
+    bool                  isDestroying_{false};
+    bool const            isExternalIsolate_{false};
+    bool const            isSingleThreaded_{false};
+    std::thread::id const ownerThread_{std::this_thread::get_id()}; // 单线程模式下唯一允许进入的线程
 
     std::unordered_map<ManagedResource*, v8::Global<v8::Value>>                          managedResources_;
-    std::unordered_map<std::string, bind::meta::ClassDefine const*>                      registeredClasses_;
+    // 键引用 ClassDefine::name_，类定义在注册后需保持存活
+    std::unordered_map<std::string_view, bind::meta::ClassDefine const*>                 registeredClasses_;
     std::unordered_map<bind::meta::ClassDefine const*, v8::Global<v8::FunctionTemplate>> classConstructors_;
+
+    std::unordered_map<std::string, v8::Global<v8::String>, internal::StringHash, std::equal_to<>> internedStrings_;
+    std::vector<v8::Global<v8::String>>                                                            internedSlots_;
+
+    struct StructShape {
+        v8::Global<v8::ObjectTemplate>      template_;
+        std::vector<v8::Global<v8::String>> keys_;
+    };
+    std::vector<StructShape> structShapes_; // 按 StructShapeCache 槽位索引
+
+    StructShape& getStructShape(size_t slot, std::span<std::string_view const> names);
+
+    std::unordered_map<bind::internal::LazyObjectDefine const*, v8::Global<v8::ObjectTemplate>> lazyObjectTemplates_;
+
+    v8::Local<v8::ObjectTemplate> getLazyObjectTemplate(bind::internal::LazyObjectDefine const& define);
+
+    std::unordered_map<bind::internal::LiveContainerDefine const*, v8::Global<v8::ObjectTemplate>>
+        liveContainerTemplates_;
+
+    v8::Local<v8::ObjectTemplate> getLiveContainerTemplate(bind::internal::LiveContainerDefine const& define);
+
+    v8::Global<v8::FunctionTemplate> rangeIteratorClass_; // 所有 Iterable 共享，next() 从内部字段取回范围
+
+    v8::Local<v8::FunctionTemplate> getRangeIteratorClass();
+
+    v8::Global<v8::FunctionTemplate> streamClass_; // 所有 Stream 共享的异步迭代器类
+
+    v8::Local<v8::FunctionTemplate> getStreamClass();
+
+    // postTask 可能来自其他线程，单独加锁；放在堆上以保持 Engine 可移动
+    struct PendingTasks {
+        std::mutex                         mutex;
+        std::vector<std::function<void()>> tasks;
+        bool                               closed{false};
+    };
+    std::unique_ptr<PendingTasks> pendingTasks_{std::make_unique<PendingTasks>()};
 };
 
 
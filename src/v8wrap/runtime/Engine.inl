@@ -5,6 +5,8 @@
 
 #include "v8-object.h"
 
+#include <vector>
+
 
 namespace v8wrap {
 
@@ -20,6 +22,15 @@ Local<Value> Engine::eval(T const& str) {
     return eval(String::newString(str));
 }
 
+template <internal::FixedString Str>
+Local<String> Engine::intern() {
+    static size_t const slot = nextInternSlot();
+    if (slot < internedSlots_.size() && !internedSlots_[slot].IsEmpty()) [[likely]] {
+        return ValueHelper::wrap<String>(internedSlots_[slot].Get(isolate_));
+    }
+    return internSlot(slot, Str.view());
+}
+
 template <typename T>
 Local<Object> Engine::newInstanceOfRaw(bind::meta::ClassDefine const& bind, T* instance) {
     auto wrap = bind::JsManagedResource::make(
@@ -30,6 +41,20 @@ Local<Object> Engine::newInstanceOfRaw(bind::meta::ClassDefine const& bind, T* i
     return newInstance(bind, std::move(wrap));
 }
 
+template <typename T>
+Local<Array> Engine::newInstancesOfRaw(bind::meta::ClassDefine const& bind, std::span<T* const> instances) {
+    std::vector<std::unique_ptr<bind::JsManagedResource>> wraps;
+    wraps.reserve(instances.size());
+    for (auto instance : instances) {
+        wraps.push_back(bind::JsManagedResource::make(
+            instance,
+            [](void* res) -> void* { return res; }, // no-op
+            [](void* res) -> void { delete static_cast<T*>(res); }
+        ));
+    }
+    return newInstances(bind, wraps);
+}
+
 template <typename T>
 Local<Object> Engine::newInstanceOfView(bind::meta::ClassDefine const& bind, T* instance) {
     auto wrap = bind::JsManagedResource::make(
@@ -40,6 +65,20 @@ Local<Object> Engine::newInstanceOfView(bind::meta::ClassDefine const& bind, T*
     return newInstance(bind, std::move(wrap));
 }
 
+template <typename T>
+Local<Array> Engine::newInstancesOfView(bind::meta::ClassDefine const& bind, std::span<T* const> instances) {
+    std::vector<std::unique_ptr<bind::JsManagedResource>> wraps;
+    wraps.reserve(instances.size());
+    for (auto instance : instances) {
+        wraps.push_back(bind::JsManagedResource::make(
+            instance,
+            [](void* res) -> void* { return res; }, // no-op
+            [](void*) -> void {}
+        ));
+    }
+    return newInstances(bind, wraps);
+}
+
 template <typename T>
 Local<Object>
 Engine::newInstanceOfView(bind::meta::ClassDefine const& bind, T* instance, Local<Object> const& ownerJs) {
@@ -103,5 +142,21 @@ T* Engine::getNativeInstanceOf(Local<Object> const& obj) const {
     return static_cast<T*>(this->getNativeInstanceOf(obj));
 }
 
+bind::JsManagedResource* Engine::getManagedResourceUnchecked(v8::Local<v8::Object> const& obj) {
+    auto wrapped = obj->GetAlignedPointerFromInternalField(kInternalField_WrappedResource);
+    return static_cast<bind::JsManagedResource*>(wrapped);
+}
+
+Engine* Engine::fromIsolate(v8::Isolate* isolate) {
+    if (foreignIsolateData_.load(std::memory_order_relaxed)) [[unlikely]] {
+        return fromContext(isolate->GetCurrentContext());
+    }
+    auto data = isolate->GetData(kIsolateDataSlot);
+    if (data != &kSharedIsolateTag) [[likely]] {
+        return static_cast<Engine*>(data);
+    }
+    return fromContext(isolate->GetCurrentContext());
+}
+
 
 } // namespace v8wrap
\ No newline at end of file
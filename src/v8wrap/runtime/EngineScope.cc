@@ -1,6 +1,8 @@
 #include "v8wrap/runtime/EngineScope.h"
 #include "v8wrap/runtime/Engine.h"
+#include "v8wrap/runtime/Exception.h"
 #include <stdexcept>
+#include <thread>
 
 
 namespace v8wrap {
@@ -8,13 +10,21 @@ namespace v8wrap {
 thread_local EngineScope* EngineScope::gCurrentScope = nullptr;
 
 EngineScope::EngineScope(Engine& runtime) : EngineScope(&runtime) {}
-EngineScope::EngineScope(Engine* runtime)
-: mRuntime(runtime),
-  mPrev(gCurrentScope),
-  mLocker(runtime->isolate_),
-  mIsolateScope(runtime->isolate_),
-  mHandleScope(runtime->isolate_),
-  mContextScope(runtime->context_.Get(runtime->isolate_)) {
+EngineScope::EngineScope(Engine* runtime) : mRuntime(runtime), mPrev(gCurrentScope), mIsolate(runtime->isolate_) {
+    if (mPrev != nullptr && mPrev->mRuntime == runtime) {
+        // 重入：锁、isolate 与 context 均已由外层作用域进入
+        mHandleScope.emplace(mIsolate);
+        mContext = mPrev->mContext;
+    } else {
+        if (runtime->isSingleThreaded_ && std::this_thread::get_id() != runtime->ownerThread_) [[unlikely]] {
+            throw std::logic_error("Single-threaded engine entered from a thread other than its owner");
+        }
+        mLocker.emplace(*runtime);
+        mIsolateScope.emplace(mIsolate);
+        mHandleScope.emplace(mIsolate);
+        mContext = runtime->context_.Get(mIsolate);
+        mContextScope.emplace(mContext);
+    }
     gCurrentScope = this;
 }
 
@@ -27,30 +37,70 @@ Engine* EngineScope::currentRuntime() {
     return nullptr;
 }
 
-Engine& EngineScope::currentRuntimeChecked() {
-    auto current = currentRuntime();
-    if (current == nullptr) {
-        throw std::logic_error("No EngineScope active");
-    }
-    return *current;
+Engine& EngineScope::currentRuntimeChecked() { return *const_cast<Engine*>(currentScopeChecked()->mRuntime); }
+
+void EngineScope::throwNoScope() { throw std::logic_error("No EngineScope active"); }
+
+
+thread_local ErrorScope* ErrorScope::gCurrentScope = nullptr;
+
+ErrorScope::ErrorScope()
+: mEngineScope(EngineScope::gCurrentScope),
+  mPrev(gCurrentScope),
+  mIsolate(EngineScope::currentRuntimeIsolateChecked()),
+  mContext(EngineScope::currentRuntimeContextChecked()),
+  mTryCatch(mIsolate),
+  mUncaughtExceptions(std::uncaught_exceptions()) {
+    gCurrentScope = this;
 }
 
-std::tuple<v8::Isolate*, v8::Local<v8::Context>> EngineScope::currentIsolateAndContextChecked() {
-    auto& current = currentRuntimeChecked();
-    return std::make_tuple(current.isolate_, current.context_.Get(current.isolate_));
+ErrorScope::~ErrorScope() noexcept(false) {
+    gCurrentScope = mPrev;
+    if (mFailed && std::uncaught_exceptions() == mUncaughtExceptions) {
+        rethrow();
+    }
 }
 
-v8::Isolate*           EngineScope::currentRuntimeIsolateChecked() { return currentRuntimeChecked().isolate_; }
-v8::Local<v8::Context> EngineScope::currentRuntimeContextChecked() {
-    auto& current = currentRuntimeChecked();
-    return current.context_.Get(current.isolate_);
+bool ErrorScope::hasError() const { return mFailed; }
+
+void ErrorScope::rethrow() {
+    if (!mFailed) {
+        return;
+    }
+    mFailed = false;
+    if (mTryCatch.HasCaught()) {
+        Exception error{mTryCatch};
+        mTryCatch.Reset();
+        throw error;
+    }
+    throw Exception{"Operation failed inside ErrorScope"};
 }
 
 
-ExitEngineScope::ExitEngineScope() : mUnlocker(EngineScope::currentRuntimeChecked().isolate_) {}
+ExitEngineScope::ExitEngineScope() : mPrev(EngineScope::currentScopeChecked()) {
+    if (!mPrev->mRuntime->isSingleThreaded_) {
+        mUnlocker.emplace(mPrev->mIsolate);
+    }
+    // 退出期间再次进入同一 Engine 时需要重新加锁，不能走重入路径
+    EngineScope::gCurrentScope = nullptr;
+}
+
+ExitEngineScope::~ExitEngineScope() { EngineScope::gCurrentScope = mPrev; }
 
 namespace internal {
 
+EngineLocker::EngineLocker(Engine const& runtime) {
+    if (!runtime.isSingleThreaded_) {
+        mLocker.emplace(runtime.isolate_);
+    }
+}
+
+CallbackScope::CallbackScope(v8::Isolate* isolate) : mRuntime(Engine::fromIsolate(isolate)) {
+    if (mRuntime != nullptr && EngineScope::currentRuntime() != mRuntime) {
+        mScope.emplace(mRuntime);
+    }
+}
+
 V8EscapeScope::V8EscapeScope() : mHandleScope(EngineScope::currentRuntimeChecked().isolate_) {}
 V8EscapeScope::V8EscapeScope(v8::Isolate* isolate) : mHandleScope(isolate) {}
 
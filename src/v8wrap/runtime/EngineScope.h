@@ -1,8 +1,13 @@
 #pragma once
 #include "v8wrap/Global.h"
 
+#include <exception>
+#include <optional>
+#include <tuple>
+
 V8_WRAP_WARNING_GUARD_BEGIN
 #include <v8-context.h>
+#include <v8-exception.h>
 #include <v8-isolate.h>
 #include <v8-locker.h>
 #include <v8.h>
@@ -13,6 +18,27 @@ namespace v8wrap {
 
 class Engine;
 
+namespace internal {
+
+// 多线程模式的 Engine 持有 v8::Locker，单线程模式下不加锁
+class EngineLocker final {
+    std::optional<v8::Locker> mLocker;
+
+public:
+    explicit EngineLocker(Engine const& runtime);
+    ~EngineLocker() = default;
+
+    V8WRAP_DISALLOW_COPY_AND_MOVE(EngineLocker);
+    V8WRAP_DISALLOW_NEW();
+};
+
+} // namespace internal
+
+/**
+ * 引擎作用域：加锁并进入 Engine 的 isolate 与 context
+ * @note 当前线程已处于同一 Engine 的作用域内时 (例如 Js -> C++ -> Js 的回调链中再次进入)，只创建 HandleScope
+ * @note 单线程模式的 Engine 不加锁，仅允许在创建它的线程中进入
+ */
 class EngineScope final {
 public:
     explicit EngineScope(Engine& runtime);
@@ -26,32 +52,134 @@ public:
 
     static Engine& currentRuntimeChecked();
 
-    static std::tuple<v8::Isolate*, v8::Local<v8::Context>> currentIsolateAndContextChecked();
+    // isolate 与 context 在进入作用域时缓存，获取时不会再次从 Global 创建句柄
+    inline static std::tuple<v8::Isolate*, v8::Local<v8::Context>> currentIsolateAndContextChecked() {
+        auto scope = currentScopeChecked();
+        return {scope->mIsolate, scope->mContext};
+    }
+
+    inline static v8::Isolate* currentRuntimeIsolateChecked() { return currentScopeChecked()->mIsolate; }
+
+    inline static v8::Local<v8::Context> currentRuntimeContextChecked() { return currentScopeChecked()->mContext; }
 
-    static v8::Isolate* currentRuntimeIsolateChecked();
+    /**
+     * 不检查是否存在 EngineScope 的快速访问，仅供内部在确定处于 EngineScope 内时使用
+     */
+    [[nodiscard]] inline static v8::Isolate* currentIsolateUnchecked() { return gCurrentScope->mIsolate; }
 
-    static v8::Local<v8::Context> currentRuntimeContextChecked();
+    [[nodiscard]] inline static v8::Local<v8::Context> const& currentContextUnchecked() {
+        return gCurrentScope->mContext;
+    }
 
 private:
+    inline static EngineScope* currentScopeChecked() {
+        if (gCurrentScope == nullptr) [[unlikely]] {
+            throwNoScope();
+        }
+        return gCurrentScope;
+    }
+
+    [[noreturn]] static void throwNoScope();
+
     // 作用域链
     Engine const* mRuntime{nullptr};
     EngineScope*  mPrev{nullptr};
+    v8::Isolate*  mIsolate{nullptr};
 
-    // v8作用域
-    v8::Locker         mLocker;
-    v8::Isolate::Scope mIsolateScope;
-    v8::HandleScope    mHandleScope;
-    v8::Context::Scope mContextScope;
+    // v8作用域，重入时只创建 mHandleScope，mContext 沿用外层作用域的句柄
+    std::optional<internal::EngineLocker> mLocker;
+    std::optional<v8::Isolate::Scope>     mIsolateScope;
+    std::optional<v8::HandleScope>        mHandleScope;
+    v8::Local<v8::Context>                mContext;
+    std::optional<v8::Context::Scope>     mContextScope;
 
     static thread_local EngineScope* gCurrentScope;
+
+    friend class Engine;
+    friend class ExitEngineScope;
+
+    friend class ErrorScope;
+};
+
+/**
+ * 错误作用域：为整段代码安装一个 v8::TryCatch，并缓存当前的 isolate/context
+ * 作用域内的 Local 操作 (Object/Array 读写、Function 调用等) 不再各自创建 TryCatch、查询 EngineScope 与检查异常，
+ * 失败时只记录错误并返回默认值 (undefined/false)，之后的操作直接跳过；错误在 rethrow() 或作用域结束时统一抛出
+ * @note 必须在 EngineScope 内创建；进入其他 EngineScope 或调用 Js 函数期间此作用域不生效
+ * @note 析构时若存在未处理的错误且当前没有正在传播的异常，将抛出 Exception
+ * @code
+ * ErrorScope errors;
+ * for (size_t i = 0; i < n; ++i) array.set(i, obj.get(key));
+ * errors.rethrow();
+ */
+class ErrorScope final {
+public:
+    explicit ErrorScope();
+    ~ErrorScope() noexcept(false);
+
+    V8WRAP_DISALLOW_COPY_AND_MOVE(ErrorScope);
+    V8WRAP_DISALLOW_NEW();
+
+    [[nodiscard]] bool hasError() const;
+
+    /**
+     * 存在错误时抛出 Exception 并清除错误，作用域可继续使用
+     */
+    void rethrow();
+
+    /**
+     * 当前生效的错误作用域，仅当其所属的 EngineScope 仍是当前 EngineScope 时返回
+     */
+    [[nodiscard]] inline static ErrorScope* current() {
+        auto scope = gCurrentScope;
+        return scope != nullptr && scope->mEngineScope == EngineScope::gCurrentScope ? scope : nullptr;
+    }
+
+    [[nodiscard]] v8::Isolate* isolate() const { return mIsolate; }
+
+    [[nodiscard]] v8::Local<v8::Context> const& context() const { return mContext; }
+
+    // 由作用域内的操作调用，记录失败 (异常已被本作用域的 TryCatch 捕获)
+    void markFailed() { mFailed = true; }
+
+    /**
+     * 在作用域内暂时停用当前的错误作用域，用于调用 Js 函数等可能重入 C++ 回调的操作
+     */
+    class Suspend final {
+    public:
+        explicit Suspend() : mPrev(gCurrentScope) { gCurrentScope = nullptr; }
+        ~Suspend() { gCurrentScope = mPrev; }
+
+        V8WRAP_DISALLOW_COPY_AND_MOVE(Suspend);
+        V8WRAP_DISALLOW_NEW();
+
+    private:
+        ErrorScope* mPrev;
+    };
+
+private:
+    EngineScope const*     mEngineScope{nullptr};
+    ErrorScope*            mPrev{nullptr};
+    v8::Isolate*           mIsolate{nullptr};
+    v8::Local<v8::Context> mContext;
+    v8::TryCatch           mTryCatch;
+    bool                   mFailed{false};
+    int                    mUncaughtExceptions{0};
+
+    static thread_local ErrorScope* gCurrentScope;
 };
 
+/**
+ * 临时退出当前的 EngineScope 并解锁，期间其他线程可以进入该 Engine
+ * @note 单线程模式的 Engine 不解锁，仅退出作用域
+ */
 class ExitEngineScope final {
-    v8::Unlocker mUnlocker;
+    EngineScope*                mPrev{nullptr};
+    std::optional<v8::Unlocker> mUnlocker;
 
 public:
     explicit ExitEngineScope();
-    ~ExitEngineScope() = default;
+    ~ExitEngineScope();
 
     V8WRAP_DISALLOW_COPY_AND_MOVE(ExitEngineScope);
     V8WRAP_DISALLOW_NEW();
@@ -60,6 +188,24 @@ public:
 
 namespace internal {
 
+/**
+ * V8 回调入口：当前线程未处于回调所属 Engine 的作用域时 (例如由 Node 等外部代码直接调用回调)，为本次回调进入该 Engine
+ * @note Engine 通过 Engine::fromIsolate 查找，不依赖 EngineScope；已处于该 Engine 的作用域时不做任何事
+ */
+class CallbackScope final {
+    Engine*                    mRuntime;
+    std::optional<EngineScope> mScope;
+
+public:
+    explicit CallbackScope(v8::Isolate* isolate);
+    ~CallbackScope() = default;
+
+    V8WRAP_DISALLOW_COPY_AND_MOVE(CallbackScope);
+    V8WRAP_DISALLOW_NEW();
+
+    [[nodiscard]] Engine* runtime() const { return mRuntime; }
+};
+
 class V8EscapeScope final {
     v8::EscapableHandleScope mHandleScope;
 
@@ -97,9 +97,9 @@ void Platform::ensureInitialized() const {
     }
 }
 
-Engine* Platform::newEngine() {
+Engine* Platform::newEngine(Engine::ThreadMode mode) {
     ensureInitialized();
-    auto engine         = std::make_unique<Engine>();
+    auto engine         = std::make_unique<Engine>(mode);
     auto [ptr, success] = impl_->addEngine(std::move(engine));
     return ptr;
 }
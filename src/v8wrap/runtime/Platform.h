@@ -1,6 +1,7 @@
 #pragma once
 #include "v8wrap/Global.h"
 #include "v8wrap/Types.h"
+#include "v8wrap/runtime/Engine.h"
 
 #include <cstddef>
 #include <memory>
@@ -32,7 +33,7 @@ public:
 
     void shutdown();
 
-    [[nodiscard]] Engine* newEngine();
+    [[nodiscard]] Engine* newEngine(Engine::ThreadMode mode = Engine::ThreadMode::MultiThreaded);
 
     /**
      * @brief 添加一个引擎到平台中
@@ -12,14 +12,23 @@ struct FunctionTraits : FunctionTraits<decltype(&T::operator())> {};
 // 普通函数 / 函数指针
 template <typename R, typename... Args>
 struct FunctionTraits<R (*)(Args...)> {
-    using ReturnType          = R;
-    using ArgsTuple           = std::tuple<Args...>;
-    static constexpr size_t N = sizeof...(Args);
+    using ReturnType                   = R;
+    using ArgsTuple                    = std::tuple<Args...>;
+    static constexpr size_t N          = sizeof...(Args);
+    static constexpr bool   IsNoexcept = false;
+};
+
+template <typename R, typename... Args>
+struct FunctionTraits<R (*)(Args...) noexcept> : FunctionTraits<R (*)(Args...)> {
+    static constexpr bool IsNoexcept = true;
 };
 
 template <typename R, typename... Args>
 struct FunctionTraits<R(Args...)> : FunctionTraits<R (*)(Args...)> {};
 
+template <typename R, typename... Args>
+struct FunctionTraits<R(Args...) noexcept> : FunctionTraits<R (*)(Args...) noexcept> {};
+
 // std::function
 template <typename R, typename... Args>
 struct FunctionTraits<std::function<R(Args...)>> : FunctionTraits<R (*)(Args...)> {};
@@ -27,16 +36,24 @@ struct FunctionTraits<std::function<R(Args...)>> : FunctionTraits<R (*)(Args...)
 // 成员函数指针（包括 const / noexcept 等）
 template <typename C, typename R, typename... Args>
 struct FunctionTraits<R (C::*)(Args...)> {
-    using ReturnType          = R;
-    using ArgsTuple           = std::tuple<Args...>;
-    static constexpr size_t N = sizeof...(Args);
+    using ReturnType                   = R;
+    using ArgsTuple                    = std::tuple<Args...>;
+    static constexpr size_t N          = sizeof...(Args);
+    static constexpr bool   IsNoexcept = false;
 };
 
 template <typename C, typename R, typename... Args>
 struct FunctionTraits<R (C::*)(Args...) const> : FunctionTraits<R (C::*)(Args...)> {};
 
 template <typename C, typename R, typename... Args>
-struct FunctionTraits<R (C::*)(Args...) const noexcept> : FunctionTraits<R (C::*)(Args...) const> {};
+struct FunctionTraits<R (C::*)(Args...) noexcept> : FunctionTraits<R (C::*)(Args...)> {
+    static constexpr bool IsNoexcept = true;
+};
+
+template <typename C, typename R, typename... Args>
+struct FunctionTraits<R (C::*)(Args...) const noexcept> : FunctionTraits<R (C::*)(Args...) const> {
+    static constexpr bool IsNoexcept = true;
+};
 
 
 template <typename T>
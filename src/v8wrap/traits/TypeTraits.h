@@ -12,15 +12,31 @@ struct RawTypeHelper {
     using Decayed = std::decay_t<T>;
     using type    = std::conditional_t<
            concepts::StringLike<Decayed>,
-           std::string_view,              // 命中 StringLike -> 强制映射为 string_view (fix const char[N])
-           std::remove_pointer_t<Decayed> // 其他类型 -> 移除指针
-           >;
+           std::string_view, // 命中 StringLike -> 强制映射为 string_view (fix const char[N])
+           std::conditional_t<
+               concepts::U16StringLike<Decayed>,
+               std::u16string_view,           // 同上 (fix const char16_t[N])
+               std::remove_pointer_t<Decayed> // 其他类型 -> 移除指针
+               >>;
 };
 
 template <typename T>
 using RawType_t = typename RawTypeHelper<T>::type;
 
 
+template <typename T>
+struct MemberTypeHelper;
+
+template <typename C, typename T>
+struct MemberTypeHelper<T C::*> {
+    using type = T;
+};
+
+// T C::* -> T
+template <typename T>
+using MemberType_t = typename MemberTypeHelper<std::remove_cvref_t<T>>::type;
+
+
 template <typename T>
 inline constexpr size_t size_of_v = sizeof(T);
 
@@ -0,0 +1,48 @@
+#pragma once
+#include "v8wrap/Global.h"
+#include "v8wrap/Types.h"
+
+#include <cstddef>
+
+
+V8_WRAP_WARNING_GUARD_BEGIN
+#include <v8-function-callback.h>
+V8_WRAP_WARNING_GUARD_END
+
+
+namespace v8wrap {
+
+namespace bind::adapter {
+struct Trampoline;
+struct RawArguments;
+}
+
+/**
+ * 回调参数，是对 v8::FunctionCallbackInfo 的非拥有视图，仅在回调期间有效
+ */
+class Arguments {
+    Engine*                                    mRuntime;
+    v8::FunctionCallbackInfo<v8::Value> const& mArgs;
+
+    explicit Arguments(Engine* runtime, v8::FunctionCallbackInfo<v8::Value> const& args);
+
+    friend class Engine;
+    friend class Function;
+    friend struct bind::adapter::Trampoline;
+    friend struct bind::adapter::RawArguments;
+
+public:
+    V8WRAP_DISALLOW_COPY_AND_MOVE(Arguments);
+
+    [[nodiscard]] Engine* runtime() const;
+
+    [[nodiscard]] bool hasThiz() const;
+
+    [[nodiscard]] Local<Object> thiz() const; // this
+
+    [[nodiscard]] size_t length() const;
+
+    Local<Value> operator[](size_t index) const;
+};
+
+} // namespace v8wrap
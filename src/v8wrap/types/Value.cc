@@ -3,16 +3,21 @@
 #include "v8wrap/runtime/Engine.h"
 #include "v8wrap/runtime/EngineScope.h"
 #include "v8wrap/runtime/Exception.h"
+#include "v8wrap/types/internal/StringHelper.h"
+#include <cstring>
 #include <string_view>
 
 
 V8_WRAP_WARNING_GUARD_BEGIN
+#include <v8-array-buffer.h>
+#include <v8-container.h>
 #include <v8-exception.h>
 #include <v8-external.h>
 #include <v8-function-callback.h>
 #include <v8-local-handle.h>
 #include <v8-primitive.h>
 #include <v8-template.h>
+#include <v8-typed-array.h>
 #include <v8-value.h>
 V8_WRAP_WARNING_GUARD_END
 
@@ -54,6 +59,9 @@ Local<Number> Number::newNumber(float f) {
 Local<String> String::newString(const char* str) { return newString(std::string_view{str}); }
 Local<String> String::newString(std::string const& str) { return newString(str.c_str()); }
 Local<String> String::newString(std::string_view str) {
+    if (internal::isAscii(str)) {
+        return newLatin1String(str); // ASCII 与 Latin-1 编码一致，跳过 UTF-8 解码
+    }
     auto isolate = EngineScope::currentRuntimeIsolateChecked();
 
     v8::TryCatch vtry{isolate};
@@ -63,6 +71,132 @@ Local<String> String::newString(std::string_view str) {
     Exception::rethrow(vtry);
     return Local<String>{v8Str.ToLocalChecked()};
 }
+Local<String> String::newString(std::u16string_view str) {
+    auto isolate = EngineScope::currentRuntimeIsolateChecked();
+
+    v8::TryCatch vtry{isolate};
+
+    auto v8Str = v8::String::NewFromTwoByte(
+        isolate,
+        reinterpret_cast<uint16_t const*>(str.data()),
+        v8::NewStringType::kNormal,
+        static_cast<int>(str.length())
+    );
+    Exception::rethrow(vtry);
+    return Local<String>{v8Str.ToLocalChecked()};
+}
+Local<String> String::newLatin1String(std::string_view str) {
+    auto isolate = EngineScope::currentRuntimeIsolateChecked();
+
+    v8::TryCatch vtry{isolate};
+
+    auto v8Str = v8::String::NewFromOneByte(
+        isolate,
+        reinterpret_cast<uint8_t const*>(str.data()),
+        v8::NewStringType::kNormal,
+        static_cast<int>(str.length())
+    );
+    Exception::rethrow(vtry);
+    return Local<String>{v8Str.ToLocalChecked()};
+}
+
+namespace {
+
+// 短字符串直接拷贝更划算，外部字符串需要额外的 resource 对象
+constexpr size_t kExternalStringThreshold = 256;
+
+class OwnedOneByteStringResource final : public v8::String::ExternalOneByteStringResource {
+    std::string data_;
+
+public:
+    explicit OwnedOneByteStringResource(std::string&& data) : data_(std::move(data)) {}
+
+    const char* data() const override { return data_.data(); }
+    size_t      length() const override { return data_.size(); }
+};
+
+class StaticOneByteStringResource final : public v8::String::ExternalOneByteStringResource {
+    std::string_view data_;
+
+public:
+    explicit StaticOneByteStringResource(std::string_view data) : data_(data) {}
+
+    const char* data() const override { return data_.data(); }
+    size_t      length() const override { return data_.size(); }
+};
+
+Local<String> newExternalOneByte(v8::String::ExternalOneByteStringResource* resource) {
+    auto isolate = EngineScope::currentRuntimeIsolateChecked();
+
+    v8::TryCatch vtry{isolate};
+
+    auto v8Str = v8::String::NewExternalOneByte(isolate, resource); // takes ownership of resource
+    Exception::rethrow(vtry);
+    return ValueHelper::wrap<String>(v8Str.ToLocalChecked());
+}
+
+} // namespace
+
+Local<String> String::newString(std::string&& str) {
+    if (str.size() < kExternalStringThreshold || !internal::isAscii(str)) {
+        return newString(std::string_view{str});
+    }
+    return newExternalOneByte(new OwnedOneByteStringResource(std::move(str)));
+}
+
+namespace internal {
+
+Utf8ArgumentBuffer::Utf8ArgumentBuffer(Local<Value> const& value, bool nullTerminated) {
+    auto str     = ValueHelper::unwrap(value.asString());
+    auto isolate = EngineScope::currentRuntimeIsolateChecked();
+
+    // 外部 ASCII 字符串：直接引用，无需拷贝
+    if (!nullTerminated && str->IsExternalOneByte()) {
+        auto resource = str->GetExternalOneByteStringResource();
+        auto external = std::string_view{resource->data(), resource->length()};
+        if (isAscii(external)) {
+            data_ = external.data();
+            size_ = external.size();
+            return;
+        }
+    }
+
+    // 单字节字符串：按字节写出，若全为 ASCII 则与 UTF-8 编码一致
+    if (str->IsOneByte()) {
+        auto length = static_cast<size_t>(str->Length());
+        auto buffer = reserve(length + 1);
+        str->WriteOneByte(isolate, reinterpret_cast<uint8_t*>(buffer), 0, static_cast<int>(length));
+        buffer[length] = '\0';
+        if (isAscii({buffer, length})) {
+            data_ = buffer;
+            size_ = length;
+            return;
+        }
+    }
+
+    auto length = static_cast<size_t>(str->Utf8Length(isolate));
+    auto buffer = reserve(length + 1);
+    str->WriteUtf8(isolate, buffer, static_cast<int>(length + 1));
+    data_ = buffer;
+    size_ = length;
+}
+
+char* Utf8ArgumentBuffer::reserve(size_t capacity) {
+    if (capacity <= kInlineCapacity) {
+        return inline_;
+    }
+    heap_ = std::make_unique_for_overwrite<char[]>(capacity);
+    return heap_.get();
+}
+
+} // namespace internal
+
+Local<String> String::newStaticString(std::string_view str) {
+    if (str.size() < kExternalStringThreshold || !internal::isAscii(str)) {
+        return newString(str);
+    }
+    return newExternalOneByte(new StaticOneByteStringResource(str));
+}
 
 Local<Symbol> Symbol::newSymbol() {
     auto isolate = EngineScope::currentRuntimeIsolateChecked();
@@ -84,21 +218,22 @@ Local<Symbol> Symbol::forKey(Local<String> const& str) {
 
 Local<Function> Function::newFunctionImpl(FunctionCallback cb) {
     struct AssociateResources {
-        Engine*          runtime{nullptr};
         FunctionCallback cb;
     };
 
     auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
 
     auto vtry = v8::TryCatch{isolate};
-    auto data = std::make_unique<AssociateResources>(EngineScope::currentRuntime(), std::move(cb));
+    auto data = std::make_unique<AssociateResources>(std::move(cb));
 
     auto external = v8::External::New(isolate, static_cast<void*>(data.get())).As<v8::Value>();
     auto temp     = v8::FunctionTemplate::New(
         isolate,
         [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+            internal::CallbackScope scope{info.GetIsolate()};
+
             auto data = reinterpret_cast<AssociateResources*>(info.Data().As<v8::External>()->Value());
-            auto args = Arguments{data->runtime, info};
+            auto args = Arguments{scope.runtime(), info};
             try {
                 auto returnValue = data->cb(args); // call native
                 info.GetReturnValue().Set(ValueHelper::unwrap(returnValue));
@@ -132,6 +267,106 @@ Local<Array> Array::newArray(size_t length) {
     return Local<Array>{v8::Array::New(isolate, static_cast<int>(length))};
 }
 
+Local<Array> Array::newArray(std::span<const Local<Value>> elements) {
+    auto isolate = EngineScope::currentRuntimeIsolateChecked();
+    static_assert(
+        sizeof(Local<Value>) == sizeof(v8::Local<v8::Value>),
+        "Local<Value> must be binary-compatible with v8::Local<v8::Value>"
+    );
+    auto data = reinterpret_cast<v8::Local<v8::Value>*>(const_cast<Local<Value>*>(elements.data()));
+    return Local<Array>{v8::Array::New(isolate, data, elements.size())};
+}
+
+
+Local<ArrayBuffer> ArrayBuffer::newArrayBuffer(size_t byteLength) {
+    auto isolate = EngineScope::currentRuntimeIsolateChecked();
+    return Local<ArrayBuffer>{v8::ArrayBuffer::New(isolate, byteLength)};
+}
+Local<ArrayBuffer> ArrayBuffer::newArrayBuffer(void const* data, size_t byteLength) {
+    auto buffer = newArrayBuffer(byteLength);
+    if (byteLength != 0) {
+        std::memcpy(buffer.data(), data, byteLength);
+    }
+    return buffer;
+}
+Local<ArrayBuffer> ArrayBuffer::newExternal(void* data, size_t byteLength, Deleter deleter, void* deleterData) {
+    auto isolate = EngineScope::currentRuntimeIsolateChecked();
+
+    auto store = v8::ArrayBuffer::NewBackingStore(
+        data,
+        byteLength,
+        deleter ? deleter : v8::BackingStore::EmptyDeleter,
+        deleterData
+    );
+    return Local<ArrayBuffer>{v8::ArrayBuffer::New(isolate, std::move(store))};
+}
+
+
+Local<TypedArray>
+TypedArray::newTypedArray(TypedArrayType type, Local<ArrayBuffer> const& buffer, size_t byteOffset, size_t length) {
+    auto size     = elementSize(type);
+    auto capacity = buffer.byteLength();
+    // 以除法比较，避免 byteOffset + length * size 溢出后绕过检查
+    if (byteOffset % size != 0 || byteOffset > capacity || length > (capacity - byteOffset) / size) {
+        throw Exception{"TypedArray view is out of the ArrayBuffer bounds or misaligned", Exception::Type::RangeError};
+    }
+    auto ab = ValueHelper::unwrap(buffer);
+    switch (type) {
+    case TypedArrayType::Int8:
+        return Local<TypedArray>{v8::Int8Array::New(ab, byteOffset, length)};
+    case TypedArrayType::Uint8:
+        return Local<TypedArray>{v8::Uint8Array::New(ab, byteOffset, length)};
+    case TypedArrayType::Uint8Clamped:
+        return Local<TypedArray>{v8::Uint8ClampedArray::New(ab, byteOffset, length)};
+    case TypedArrayType::Int16:
+        return Local<TypedArray>{v8::Int16Array::New(ab, byteOffset, length)};
+    case TypedArrayType::Uint16:
+        return Local<TypedArray>{v8::Uint16Array::New(ab, byteOffset, length)};
+    case TypedArrayType::Int32:
+        return Local<TypedArray>{v8::Int32Array::New(ab, byteOffset, length)};
+    case TypedArrayType::Uint32:
+        return Local<TypedArray>{v8::Uint32Array::New(ab, byteOffset, length)};
+    case TypedArrayType::Float32:
+        return Local<TypedArray>{v8::Float32Array::New(ab, byteOffset, length)};
+    case TypedArrayType::Float64:
+        return Local<TypedArray>{v8::Float64Array::New(ab, byteOffset, length)};
+    case TypedArrayType::BigInt64:
+        return Local<TypedArray>{v8::BigInt64Array::New(ab, byteOffset, length)};
+    case TypedArrayType::BigUint64:
+        return Local<TypedArray>{v8::BigUint64Array::New(ab, byteOffset, length)};
+    }
+    throw Exception("Unknown TypedArray type");
+}
+size_t TypedArray::elementSize(TypedArrayType type) {
+    switch (type) {
+    case TypedArrayType::Int8:
+    case TypedArrayType::Uint8:
+    case TypedArrayType::Uint8Clamped:
+        return 1;
+    case TypedArrayType::Int16:
+    case TypedArrayType::Uint16:
+        return 2;
+    case TypedArrayType::Int32:
+    case TypedArrayType::Uint32:
+    case TypedArrayType::Float32:
+        return 4;
+    case TypedArrayType::Float64:
+    case TypedArrayType::BigInt64:
+    case TypedArrayType::BigUint64:
+        return 8;
+    }
+    throw Exception("Unknown TypedArray type");
+}
+
+
+Local<DataView> DataView::newDataView(Local<ArrayBuffer> const& buffer, size_t byteOffset, size_t byteLength) {
+    auto capacity = buffer.byteLength();
+    if (byteOffset > capacity || byteLength > capacity - byteOffset) {
+        throw Exception{"DataView is out of the ArrayBuffer bounds", Exception::Type::RangeError};
+    }
+    return Local<DataView>{v8::DataView::New(ValueHelper::unwrap(buffer), byteOffset, byteLength)};
+}
+
 
 Arguments::Arguments(Engine* runtime, v8::FunctionCallbackInfo<v8::Value> const& args)
 : mRuntime(runtime),
@@ -2,13 +2,18 @@
 #include "v8wrap/Global.h"
 #include "v8wrap/Types.h"
 #include "v8wrap/concepts/ScriptConcepts.h"
+#include "v8wrap/types/Arguments.h"
 #include "v8wrap/types/internal/V8TypeAlias.h"
 
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <vector>
 
 
 V8_WRAP_WARNING_GUARD_BEGIN
@@ -18,7 +23,6 @@ V8_WRAP_WARNING_GUARD_END
 
 namespace v8wrap {
 
-
 enum class ValueType {
     Null = 0,
     Undefined,
@@ -30,7 +34,27 @@ enum class ValueType {
     Object,
     Array,
     Function,
-    // TODO: Promise、(ArrayBuffer/TypedArray)、(Map/Set)、Date、RegExp、Proxy
+    ArrayBuffer,
+    TypedArray,
+    DataView,
+    // TODO: Promise、(Map/Set)、Date、RegExp、Proxy
+};
+
+/**
+ * TypedArray 的元素类型
+ */
+enum class TypedArrayType {
+    Int8 = 0,
+    Uint8,
+    Uint8Clamped,
+    Int16,
+    Uint16,
+    Int32,
+    Uint32,
+    Float32,
+    Float64,
+    BigInt64,
+    BigUint64,
 };
 
 class Value {
@@ -83,6 +107,24 @@ public:
     [[nodiscard]] static Local<String> newString(const char* str);
     [[nodiscard]] static Local<String> newString(std::string const& str);
     [[nodiscard]] static Local<String> newString(std::string_view str);
+    [[nodiscard]] static Local<String> newString(std::u16string_view str);
+
+    /**
+     * 以 Latin-1 编码的字符串创建，每个字节对应一个字符，不做 UTF-8 解码
+     */
+    [[nodiscard]] static Local<String> newLatin1String(std::string_view str);
+
+    /**
+     * 接管 std::string 的存储
+     * @note 较长的纯 ASCII 字符串会作为外部字符串直接引用，不拷贝到 V8 堆
+     */
+    [[nodiscard]] static Local<String> newString(std::string&& str);
+
+    /**
+     * 以静态存储期的字符串创建外部字符串，不进行拷贝
+     * @note str 必须在整个程序生命周期内有效（例如字符串字面量），短字符串与非 ASCII 内容会退化为拷贝
+     */
+    [[nodiscard]] static Local<String> newStaticString(std::string_view str);
 };
 
 class Symbol : public Value {
@@ -136,30 +178,78 @@ class Array : public Value {
 public:
     Array() = delete;
     [[nodiscard]] static Local<Array> newArray(size_t length = 0);
+
+    /**
+     * 一次性以给定元素创建数组，避免逐个 set 带来的开销
+     */
+    [[nodiscard]] static Local<Array> newArray(std::span<const Local<Value>> elements);
 };
 
-class Engine; // forward declaration
-class Arguments {
-    Engine*                             mRuntime;
-    v8::FunctionCallbackInfo<v8::Value> mArgs;
+class ArrayBuffer : public Value {
+public:
+    ArrayBuffer() = delete;
 
-    explicit Arguments(Engine* runtime, v8::FunctionCallbackInfo<v8::Value> const& args);
+    /**
+     * BackingStore 释放回调，与 v8::BackingStore::DeleterCallback 一致
+     */
+    using Deleter = void (*)(void* data, size_t byteLength, void* deleterData);
 
-    friend class Engine;
-    friend class Function;
+    /**
+     * 创建由 V8 分配并管理的 ArrayBuffer（内容初始化为 0）
+     */
+    [[nodiscard]] static Local<ArrayBuffer> newArrayBuffer(size_t byteLength);
 
-public:
-    V8WRAP_DISALLOW_COPY_AND_MOVE(Arguments);
+    /**
+     * 创建 ArrayBuffer 并拷贝 data 的内容
+     */
+    [[nodiscard]] static Local<ArrayBuffer> newArrayBuffer(void const* data, size_t byteLength);
+
+    /**
+     * 直接以外部内存作为 ArrayBuffer 的存储，不进行拷贝
+     * @param deleter 当 V8 不再使用该内存时调用；为 nullptr 时不释放，调用方需保证内存比所有 Js 引用活得更久
+     * @note 启用 V8 sandbox 的构建不支持外部内存
+     */
+    [[nodiscard]] static Local<ArrayBuffer>
+    newExternal(void* data, size_t byteLength, Deleter deleter = nullptr, void* deleterData = nullptr);
 
-    [[nodiscard]] Engine* runtime() const;
+    /**
+     * 接管 std::vector 的存储，不进行拷贝，ArrayBuffer 被回收时释放
+     */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    [[nodiscard]] static Local<ArrayBuffer> newArrayBuffer(std::vector<T>&& data);
+
+    /**
+     * 接管 std::unique_ptr<T[]> 的存储，不进行拷贝，ArrayBuffer 被回收时释放
+     * @param length 元素个数
+     */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    [[nodiscard]] static Local<ArrayBuffer> newArrayBuffer(std::unique_ptr<T[]>&& data, size_t length);
+};
 
-    [[nodiscard]] bool hasThiz() const;
+class TypedArray : public Value {
+public:
+    TypedArray() = delete;
 
-    [[nodiscard]] Local<Object> thiz() const; // this
+    /**
+     * 在 buffer 上创建 TypedArray 视图
+     * @param length 元素个数
+     */
+    [[nodiscard]] static Local<TypedArray>
+    newTypedArray(TypedArrayType type, Local<ArrayBuffer> const& buffer, size_t byteOffset, size_t length);
 
-    [[nodiscard]] size_t length() const;
+    /**
+     * 单个元素的字节数
+     */
+    [[nodiscard]] static size_t elementSize(TypedArrayType type);
+};
 
-    Local<Value> operator[](size_t index) const;
+class DataView : public Value {
+public:
+    DataView() = delete;
+    [[nodiscard]] static Local<DataView>
+    newDataView(Local<ArrayBuffer> const& buffer, size_t byteOffset, size_t byteLength);
 };
 
 struct ValueHelper {
@@ -3,10 +3,23 @@
 #include "v8wrap/runtime/EngineScope.h"
 #include "v8wrap/runtime/Exception.h"
 #include "v8wrap/types/Value.h"
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include "v8wrap/bind/adapter/FunctionAdapter.h"
 
+namespace v8wrap::bind::adapter {
+
+// 由 FunctionAdapter.h 定义；以 FunctionAdapter.h 为入口包含时，此处先于其定义被解析
+template <typename Func>
+FunctionCallback bindStaticFunction(Func&& func);
+
+template <typename... Func>
+FunctionCallback bindStaticOverloadedFunction(Func&&... funcs);
+
+} // namespace v8wrap::bind::adapter
+
 namespace v8wrap {
 
 
@@ -25,6 +38,39 @@ Local<BigInt> BigInt::newBigInt(T u) {
 }
 
 
+// BackingStore 的 deleter 只在 V8 不再引用该内存时调用，可能发生在任意线程
+// V8 会按 byteLength 统计 ArrayBuffer 的外部内存，这里无需再调整 AdjustAmountOfExternalAllocatedMemory
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+Local<ArrayBuffer> ArrayBuffer::newArrayBuffer(std::vector<T>&& data) {
+    auto owner = std::make_unique<std::vector<T>>(std::move(data));
+    auto bytes = owner->size() * sizeof(T);
+    auto ptr   = owner->data();
+
+    auto buffer = newExternal(
+        ptr,
+        bytes,
+        [](void*, size_t, void* deleterData) { delete static_cast<std::vector<T>*>(deleterData); },
+        owner.get()
+    );
+    (void)owner.release(); // owned by the BackingStore now
+    return buffer;
+}
+
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+Local<ArrayBuffer> ArrayBuffer::newArrayBuffer(std::unique_ptr<T[]>&& data, size_t length) {
+    auto buffer = newExternal(
+        data.get(),
+        length * sizeof(T),
+        [](void* ptr, size_t, void*) { delete[] static_cast<T*>(ptr); },
+        nullptr
+    );
+    (void)data.release(); // owned by the BackingStore now
+    return buffer;
+}
+
+
 template <typename T>
     requires concepts::JsFunctionCallback<T>
 Local<Function> Function::newFunction(T&& cb) {
@@ -0,0 +1,130 @@
+#pragma once
+#include "v8wrap/Global.h"
+#include "v8wrap/Types.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+
+namespace v8wrap::internal {
+
+
+/**
+ * 判断字符串是否全部为 ASCII 字符
+ * @note 每次检查 32 字节（4 个 64 位字的最高位），编译器可进一步自动向量化
+ */
+[[nodiscard]] inline bool isAscii(std::string_view str) noexcept {
+    constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+
+    auto const*  p = str.data();
+    size_t const n = str.size();
+    size_t       i = 0;
+
+    for (; i + 32 <= n; i += 32) {
+        uint64_t words[4];
+        std::memcpy(words, p + i, sizeof(words));
+        if ((words[0] | words[1] | words[2] | words[3]) & kHighBits) {
+            return false;
+        }
+    }
+    for (; i + 8 <= n; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, p + i, sizeof(word));
+        if (word & kHighBits) {
+            return false;
+        }
+    }
+    for (; i < n; ++i) {
+        if (static_cast<unsigned char>(p[i]) & 0x80) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * 将 Latin-1 编码的字符串原地转换为 UTF-8（U+0080 ~ U+00FF 展开为 2 字节）
+ */
+inline void latin1ToUtf8(std::string& str) {
+    if (isAscii(str)) {
+        return;
+    }
+    size_t const length = str.size();
+    size_t       extra  = 0;
+    for (auto c : str) {
+        extra += static_cast<unsigned char>(c) >> 7;
+    }
+    str.resize(length + extra);
+
+    // 从尾部向前展开，避免覆盖尚未处理的字节
+    auto* p = str.data();
+    for (size_t src = length, dst = length + extra; src > 0;) {
+        auto c = static_cast<unsigned char>(p[--src]);
+        if (c < 0x80) {
+            p[--dst] = static_cast<char>(c);
+        } else {
+            p[--dst] = static_cast<char>(0x80 | (c & 0x3F));
+            p[--dst] = static_cast<char>(0xC0 | (c >> 6));
+        }
+    }
+}
+
+
+/**
+ * 编译期字符串字面量，可作为非类型模板参数
+ * @code engine.intern<"position">()
+ */
+template <size_t N>
+struct FixedString {
+    char value[N]{};
+
+    consteval FixedString(char const (&str)[N]) { std::copy_n(str, N, value); } // NOLINT: implicit
+
+    [[nodiscard]] constexpr std::string_view view() const noexcept { return {value, N - 1}; }
+};
+
+/**
+ * 支持 std::string_view 异构查找的哈希
+ */
+struct StringHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view str) const noexcept { return std::hash<std::string_view>{}(str); }
+};
+
+
+/**
+ * 字符串参数的临时 UTF-8 缓冲区，生命周期覆盖一次 C++ 调用
+ * - 外部 ASCII 字符串直接引用其存储（仅在不要求 '\0' 结尾时）
+ * - 短字符串写入内联缓冲区，长字符串一次性堆分配
+ * @note 不可拷贝/移动，data() 可能指向自身的内联缓冲区
+ */
+class Utf8ArgumentBuffer {
+public:
+    explicit Utf8ArgumentBuffer(Local<Value> const& value, bool nullTerminated);
+
+    V8WRAP_DISALLOW_COPY_AND_MOVE(Utf8ArgumentBuffer);
+
+    [[nodiscard]] std::string_view view() const noexcept { return {data_, size_}; }
+
+    [[nodiscard]] char const* c_str() const noexcept { return data_; } // 仅 nullTerminated 时有效
+
+private:
+    static constexpr size_t kInlineCapacity = 128;
+
+    char* reserve(size_t capacity);
+
+    char                    inline_[kInlineCapacity];
+    std::unique_ptr<char[]> heap_{nullptr};
+    char const*             data_{nullptr};
+    size_t                  size_{0};
+};
+
+
+} // namespace v8wrap::internal
@@ -3,9 +3,11 @@
 #include "v8wrap/Types.h"
 
 V8_WRAP_WARNING_GUARD_BEGIN
+#include <v8-array-buffer.h>
 #include <v8-function.h>
 #include <v8-object.h>
 #include <v8-primitive.h>
+#include <v8-typed-array.h>
 #include <v8-value.h>
 V8_WRAP_WARNING_GUARD_END
 
@@ -39,6 +41,9 @@ TYPE_ALIAS(Symbol, v8::Symbol);
 TYPE_ALIAS(Function, v8::Function);
 TYPE_ALIAS(Object, v8::Object);
 TYPE_ALIAS(Array, v8::Array);
+TYPE_ALIAS(ArrayBuffer, v8::ArrayBuffer);
+TYPE_ALIAS(TypedArray, v8::TypedArray);
+TYPE_ALIAS(DataView, v8::DataView);
 
 
 #undef TYPE_ALIAS
@@ -1,3 +1,4 @@
+#include "catch2/benchmark/catch_benchmark.hpp"
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers.hpp"
 #include "catch2/matchers/catch_matchers_exception.hpp"
@@ -5,8 +6,10 @@
 #include <catch2/matchers/catch_matchers_string.hpp>
 
 #include "v8wrap/Types.h"
+#include "v8wrap/bind/ClassConverter.h"
 #include "v8wrap/bind/TypeConverter.h"
 #include "v8wrap/bind/builder/ClassDefineBuilder.h"
+#include "v8wrap/bind/builder/ClassDefineTableBuilder.h"
 #include "v8wrap/reference/Local.h"
 #include "v8wrap/runtime/Engine.h"
 #include "v8wrap/runtime/EngineScope.h"
@@ -15,10 +18,21 @@
 #include "v8wrap/types/Value.h"
 
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <utility>
-
+#include <variant>
+#include <vector>
 
 struct BindingTestFixture {
     BindingTestFixture() { rt = v8wrap::Platform::getInstance().newEngine(); }
@@ -511,4 +525,853 @@ TEST_CASE_METHOD(BindingTestFixture, "Instance binding") {
         REQUIRE(rt->isInstanceOf(myUUID.asObject(), UUIDBind));
         REQUIRE(rt->getNativeInstanceOf<UUID>(myUUID.asObject())->str_id_ == "A3.1415926535");
     }
-}
\ No newline at end of file
+}
+
+
+TEST_CASE_METHOD(BindingTestFixture, "Instance bulk construction") {
+    v8wrap::EngineScope enter{rt};
+
+    REQUIRE_NOTHROW(rt->registerClass(UUIDBind));
+
+    std::vector<UUID*> uuids{new UUID("a"), new UUID("b"), new UUID("c")};
+
+    auto array = rt->newInstancesOfRaw<UUID>(UUIDBind, uuids);
+    REQUIRE(array.length() == uuids.size());
+    for (size_t i = 0; i < uuids.size(); ++i) {
+        auto element = array.get(i);
+        REQUIRE(element.isObject());
+        REQUIRE(rt->isInstanceOf(element.asObject(), UUIDBind));
+        REQUIRE(rt->getNativeInstanceOf<UUID>(element.asObject()) == uuids[i]);
+    }
+
+    rt->setVauleToGlobalThis(v8wrap::String::newString("uuids"), array);
+    auto joined = rt->eval("uuids.map(u => u.getUUID()).join('');");
+    REQUIRE(joined.isString());
+    REQUIRE(joined.asString().getValue() == "abc");
+}
+
+class Vec3 {
+public:
+    double x_, y_, z_;
+
+    Vec3(double x, double y, double z) : x_(x), y_(y), z_(z) {}
+
+    double dot(double x, double y, double z) const noexcept { return x_ * x + y_ * y + z_ * z; }
+
+    void scale(double factor) noexcept {
+        x_ *= factor;
+        y_ *= factor;
+        z_ *= factor;
+    }
+
+    static int32_t sum(int32_t a, int32_t b) noexcept { return a + b; }
+
+    static bool isZero(double value) noexcept { return value == 0.0; }
+};
+
+v8wrap::bind::meta::ClassDefine Vec3Bind = v8wrap::bind::defineClass<Vec3>("Vec3")
+                                               .constructor<double, double, double>()
+                                               .instanceProperty("x_", &Vec3::x_)
+                                               .instanceMethod("dot", &Vec3::dot)
+                                               .instanceMethod("scale", &Vec3::scale)
+                                               .function("sum", &Vec3::sum)
+                                               .function("isZero", &Vec3::isZero)
+                                               .build();
+
+TEST_CASE_METHOD(BindingTestFixture, "Fast API binding") {
+    v8wrap::EngineScope enter{rt};
+
+    REQUIRE_NOTHROW(rt->registerClass(Vec3Bind));
+
+    // Only noexcept functions with primitive signatures get a fast callback
+    auto find = [](auto const& list, std::string_view name) {
+        return std::find_if(list.begin(), list.end(), [&](auto const& item) { return item.name_ == name; });
+    };
+    REQUIRE(find(Vec3Bind.instanceMemberDef_.methods_, "dot")->fastCallback_.valid());
+    REQUIRE(find(Vec3Bind.instanceMemberDef_.methods_, "scale")->fastCallback_.valid());
+    REQUIRE(find(Vec3Bind.staticMemberDef_.functions_, "sum")->fastCallback_.valid());
+    REQUIRE_FALSE(find(PlayerBind.instanceMemberDef_.methods_, "getName")->fastCallback_.valid());
+
+    // Hot loops give TurboFan the chance to switch to the fast path, results must stay identical
+    auto dot = rt->eval(R"(
+        const v = new Vec3(1, 2, 3);
+        let acc = 0;
+        for (let i = 0; i < 100000; ++i) acc += v.dot(1, 1, 1);
+        acc;
+    )");
+    REQUIRE(dot.isNumber());
+    REQUIRE(dot.asNumber().getDouble() == 600000.0);
+
+    auto sum = rt->eval(R"(
+        let total = 0;
+        for (let i = 0; i < 100000; ++i) total = Vec3.sum(total, 1);
+        total;
+    )");
+    REQUIRE(sum.isNumber());
+    REQUIRE(sum.asNumber().getInt32() == 100000);
+
+    REQUIRE(rt->eval("Vec3.isZero(0)").asBoolean().getValue() == true);
+    REQUIRE(rt->eval("const s = new Vec3(1, 1, 1); s.scale(2); s.x_;").asNumber().getDouble() == 2.0);
+
+    // The slow path still reports argument errors
+    REQUIRE_THROWS_MATCHES(
+        rt->eval("Vec3.sum(1);"),
+        v8wrap::Exception,
+        Catch::Matchers::ExceptionMessageMatcher("Uncaught TypeError: argument count mismatch")
+    );
+}
+
+
+class FastProbe {
+public:
+    static inline int calls_ = 0;
+
+    FastProbe() = default;
+
+    int32_t hit(int32_t value) noexcept {
+        ++calls_;
+        return value + 1;
+    }
+};
+
+v8wrap::bind::meta::ClassDefine FastProbeBind =
+    v8wrap::bind::defineClass<FastProbe>("FastProbe").constructor<>().instanceMethod("hit", &FastProbe::hit).build();
+
+// 与 FastProbeBind 共用快速路径，慢速路径额外计数，用于区分 V8 实际走的调用路径
+int fastProbeSlowCalls = 0;
+
+v8wrap::Local<v8wrap::Value> countSlowCall(void const* data, void* instance, v8wrap::Arguments const& args) {
+    ++fastProbeSlowCalls;
+    using Ref = v8wrap::bind::meta::CallbackRef<v8wrap::InstanceMethodCallback>;
+    return (*static_cast<Ref const*>(data))(instance, args);
+}
+
+v8wrap::bind::meta::InstanceMemberDefine::Method const CountedProbeMethods[] = {
+    v8wrap::bind::meta::InstanceMemberDefine::Method{
+        "hit",
+        v8wrap::bind::meta::CallbackRef<v8wrap::InstanceMethodCallback>{
+            &countSlowCall,
+            &FastProbeBind.instanceMemberDef_.methods_[0].callback_
+        },
+        FastProbeBind.instanceMemberDef_.methods_[0].fastCallback_
+    }
+};
+
+v8wrap::bind::meta::ClassDefine CountedProbeBind{
+    "FastProbe",
+    FastProbeBind.staticMemberDef_,
+    v8wrap::bind::meta::InstanceMemberDefine{
+        FastProbeBind.instanceMemberDef_.constructor_,
+        {},
+        CountedProbeMethods,
+        FastProbeBind.instanceMemberDef_.classSize_,
+        FastProbeBind.instanceMemberDef_.equals_
+    },
+    nullptr,
+    FastProbeBind.factory_,
+    nullptr
+};
+
+TEST_CASE_METHOD(BindingTestFixture, "Fast API optimized instance method") {
+    v8wrap::EngineScope enter{rt};
+
+    REQUIRE(CountedProbeMethods[0].fastCallback_.valid());
+    REQUIRE_NOTHROW(rt->registerClass(CountedProbeBind));
+
+    // %PrepareFunctionForOptimization 等 natives 语法由 TestMain 中的 --allow-natives-syntax 启用
+    FastProbe::calls_  = 0;
+    fastProbeSlowCalls = 0;
+    auto result        = rt->eval(R"(
+        const probe = new FastProbe();
+        function callHit(value) { return probe.hit(value); }
+        %PrepareFunctionForOptimization(callHit);
+        callHit(1);
+        callHit(2);
+        %OptimizeFunctionOnNextCall(callHit);
+        callHit(41);
+    )");
+    REQUIRE(result.asNumber().getInt32() == 42);
+    REQUIRE(FastProbe::calls_ == 3);
+    REQUIRE(fastProbeSlowCalls == 2); // the optimized call went through the fast callback
+}
+
+class Shape {
+public:
+    std::string kind_;
+
+    explicit Shape(int sides) : kind_("polygon:" + std::to_string(sides)) {}
+    explicit Shape(std::string const& name) : kind_(name) {}
+    Shape(double w, double h) : kind_("rect:" + std::to_string(static_cast<int>(w * h))) {}
+
+    std::string describe(bool verbose) const { return verbose ? "shape " + kind_ : kind_; }
+    std::string describe(std::string const& prefix) const { return prefix + kind_; }
+    std::string describe(std::optional<int> const& width) const {
+        return kind_ + "/" + std::to_string(width.value_or(0));
+    }
+};
+
+v8wrap::bind::meta::ClassDefine ShapeBind =
+    v8wrap::bind::defineClass<Shape>("Shape")
+        .constructor<int>()
+        .constructor<std::string const&>()
+        .constructor<double, double>()
+        .instanceProperty("kind_", &Shape::kind_)
+        .instanceMethod(
+            "describe",
+            static_cast<std::string (Shape::*)(bool) const>(&Shape::describe),
+            static_cast<std::string (Shape::*)(std::string const&) const>(&Shape::describe),
+            static_cast<std::string (Shape::*)(std::optional<int> const&) const>(&Shape::describe)
+        )
+        .build();
+
+TEST_CASE_METHOD(BindingTestFixture, "Overload resolution") {
+    v8wrap::EngineScope enter{rt};
+
+    SECTION("Static functions pick by arity and type") {
+        auto fn = v8wrap::Function::newFunction(
+            [](bool) { return std::string{"bool"}; },
+            [](int) { return std::string{"number"}; },
+            [](std::string const&) { return std::string{"string"}; },
+            [](std::vector<int> const&) { return std::string{"array"}; },
+            [](int, int) { return std::string{"number,number"}; }
+        );
+        rt->getGlobalThis().set(v8wrap::String::newString("pick"), fn);
+
+        REQUIRE(rt->eval("pick(true)").asString().getValue() == "bool");
+        REQUIRE(rt->eval("pick(1)").asString().getValue() == "number");
+        REQUIRE(rt->eval("pick('x')").asString().getValue() == "string");
+        REQUIRE(rt->eval("pick([1, 2])").asString().getValue() == "array");
+        REQUIRE(rt->eval("pick(1, 2)").asString().getValue() == "number,number");
+
+        REQUIRE_THROWS_MATCHES(
+            rt->eval("pick({})"),
+            v8wrap::Exception,
+            Catch::Matchers::ExceptionMessageMatcher("Uncaught TypeError: no overload found")
+        );
+    }
+
+    SECTION("Constructors and instance methods") {
+        REQUIRE_NOTHROW(rt->registerClass(ShapeBind));
+
+        REQUIRE(rt->eval("new Shape(3).kind_").asString().getValue() == "polygon:3");
+        REQUIRE(rt->eval("new Shape('circle').kind_").asString().getValue() == "circle");
+        REQUIRE(rt->eval("new Shape(2, 3).kind_").asString().getValue() == "rect:6");
+
+        REQUIRE(rt->eval("new Shape(4).describe(true)").asString().getValue() == "shape polygon:4");
+        REQUIRE(rt->eval("new Shape(4).describe('a ')").asString().getValue() == "a polygon:4");
+        REQUIRE(rt->eval("new Shape(4).describe(7)").asString().getValue() == "polygon:4/7");
+        REQUIRE(rt->eval("new Shape(4).describe(null)").asString().getValue() == "polygon:4/0");
+
+        REQUIRE_THROWS_MATCHES(
+            rt->eval("new Shape({})"),
+            v8wrap::Exception,
+            Catch::Matchers::ExceptionMessageMatcher("Uncaught Error: This native class cannot be constructed.")
+        );
+    }
+}
+
+
+TEST_CASE_METHOD(BindingTestFixture, "Buffer binding") {
+    v8wrap::EngineScope enter{rt};
+
+    SECTION("span arguments borrow TypedArray storage") {
+        auto scale = v8wrap::Function::newFunction([](std::span<float> values, float factor) {
+            for (auto& v : values) v *= factor;
+        });
+        auto checksum = v8wrap::Function::newFunction([](std::span<const uint8_t> bytes) {
+            int sum = 0;
+            for (auto b : bytes) sum += b;
+            return sum;
+        });
+        rt->getGlobalThis().set(v8wrap::String::newString("scale"), scale);
+        rt->getGlobalThis().set(v8wrap::String::newString("checksum"), checksum);
+
+        auto scaled = rt->eval("const f = new Float32Array([1, 2, 3]); scale(f, 2); f.join(',');");
+        REQUIRE(scaled.asString().getValue() == "2,4,6");
+
+        REQUIRE(rt->eval("checksum(new Uint8Array([1, 2, 3]))").asNumber().getInt32() == 6);
+        REQUIRE(rt->eval("checksum(new Uint8Array([1, 2, 3, 4]).buffer)").asNumber().getInt32() == 10);
+        REQUIRE(rt->eval("checksum(new DataView(new Uint8Array([5, 6, 7]).buffer, 1))").asNumber().getInt32() == 13);
+
+        REQUIRE_THROWS_MATCHES(
+            rt->eval("scale(new Float64Array([1]), 2);"),
+            v8wrap::Exception,
+            Catch::Matchers::ExceptionMessageMatcher("Uncaught TypeError: TypedArray element type mismatch")
+        );
+    }
+
+    SECTION("span and BufferView return values") {
+        static std::array<int32_t, 3> storage{1, 2, 3};
+
+        auto copy   = v8wrap::Function::newFunction([]() { return std::span<int32_t>{storage}; });
+        auto borrow = v8wrap::Function::newFunction([]() {
+            return v8wrap::bind::BufferView<int32_t, v8wrap::bind::BufferLifetime::Borrow>{storage};
+        });
+        rt->getGlobalThis().set(v8wrap::String::newString("copyStorage"), copy);
+        rt->getGlobalThis().set(v8wrap::String::newString("borrowStorage"), borrow);
+
+        REQUIRE(rt->eval("copyStorage() instanceof Int32Array").asBoolean().getValue());
+
+        rt->eval("copyStorage()[0] = 100;");
+        REQUIRE(storage[0] == 1);
+
+        rt->eval("borrowStorage()[0] = 100;");
+        REQUIRE(storage[0] == 100);
+    }
+
+    SECTION("TransferBuffer hands ownership to JS") {
+        auto packet = v8wrap::Function::newFunction([](int size) {
+            std::vector<uint8_t> bytes(static_cast<size_t>(size));
+            std::iota(bytes.begin(), bytes.end(), uint8_t{0});
+            return v8wrap::bind::TransferBuffer<uint8_t>{std::move(bytes)};
+        });
+        rt->getGlobalThis().set(v8wrap::String::newString("packet"), packet);
+
+        auto result = rt->eval("const p = packet(1024); (p instanceof Uint8Array) + ':' + p.length + ':' + p[255];");
+        REQUIRE(result.asString().getValue() == "true:1024:255");
+
+        auto owned = std::make_unique<double[]>(2);
+        owned[1]   = 4.5;
+        auto array = v8wrap::bind::ConvertToJs(v8wrap::bind::TransferBuffer<double>{std::move(owned), 2});
+        REQUIRE(array.asTypedArray().type() == v8wrap::TypedArrayType::Float64);
+        REQUIRE(static_cast<double*>(array.asTypedArray().data())[1] == 4.5);
+
+        auto buffer = v8wrap::ArrayBuffer::newArrayBuffer(std::vector<uint16_t>{1, 2, 3});
+        REQUIRE(buffer.byteLength() == 6);
+    }
+}
+
+
+TEST_CASE_METHOD(BindingTestFixture, "String view arguments") {
+    v8wrap::EngineScope enter{rt};
+
+    auto length = v8wrap::Function::newFunction([](std::string_view str) { return static_cast<int>(str.size()); });
+    auto echo   = v8wrap::Function::newFunction([](std::string_view str) { return std::string{str}; });
+    auto cstr   = v8wrap::Function::newFunction([](char const* str) { return static_cast<int>(std::strlen(str)); });
+    rt->getGlobalThis().set(v8wrap::String::newString("length"), length);
+    rt->getGlobalThis().set(v8wrap::String::newString("echo"), echo);
+    rt->getGlobalThis().set(v8wrap::String::newString("cstr"), cstr);
+
+    SECTION("Short strings") {
+        REQUIRE(rt->eval("length('hello')").asNumber().getInt32() == 5);
+        REQUIRE(rt->eval("cstr('hello')").asNumber().getInt32() == 5);
+        REQUIRE(rt->eval("echo('')").asString().getValue().empty());
+        REQUIRE(rt->eval("echo('你好, café')").asString().getValue() == "你好, café");
+        REQUIRE(rt->eval("length('é')").asNumber().getInt32() == 2); // Latin-1 in Js, UTF-8 in C++
+    }
+
+    SECTION("Long strings") {
+        REQUIRE(rt->eval("length('x'.repeat(1000))").asNumber().getInt32() == 1000);
+        REQUIRE(rt->eval("cstr('x'.repeat(1000))").asNumber().getInt32() == 1000);
+        REQUIRE(rt->eval("length('é'.repeat(200))").asNumber().getInt32() == 400);
+
+        auto external = v8wrap::String::newString(std::string(300, 'y'));
+        REQUIRE(echo.call({}, external).asString().getValue() == std::string(300, 'y'));
+    }
+
+    SECTION("UTF-16 arguments") {
+        auto u16length = v8wrap::Function::newFunction([](std::u16string_view str) {
+            return static_cast<int>(str.size());
+        });
+        rt->getGlobalThis().set(v8wrap::String::newString("u16length"), u16length);
+        REQUIRE(rt->eval("u16length('你好')").asNumber().getInt32() == 2);
+    }
+
+    SECTION("Non-string arguments") {
+        REQUIRE_THROWS_MATCHES(
+            rt->eval("length(1)"),
+            v8wrap::Exception,
+            Catch::Matchers::ExceptionMessageMatcher("Uncaught Error: cannot convert to String")
+        );
+    }
+}
+
+
+struct Inventory {
+    std::vector<int>                             slots_{1, 2, 3};
+    std::unordered_map<std::string, std::string> tags_{{"kind", "chest"}};
+    UUID                                         owner_{"owner-1"};
+    std::deque<int>                              queue_{5, 6};
+    std::map<std::string, int>                   counts_{{"a", 1}};
+
+    Inventory() = default;
+};
+
+v8wrap::bind::meta::ClassDefine InventoryBind = v8wrap::bind::defineClass<Inventory>("Inventory")
+                                                    .constructor<>()
+                                                    .instancePropertyRef("slots", &Inventory::slots_)
+                                                    .instancePropertyRef("tags", &Inventory::tags_)
+                                                    .instancePropertyRef("owner", &Inventory::owner_, UUIDBind)
+                                                    .instancePropertyRef("queue", &Inventory::queue_)
+                                                    .instancePropertyRef("counts", &Inventory::counts_)
+                                                    .build();
+
+TEST_CASE_METHOD(BindingTestFixture, "Live container binding") {
+    v8wrap::EngineScope enter{rt};
+
+    SECTION("ContainerRef return values") {
+        static std::vector<int> shared{10, 20, 30};
+        static std::unordered_map<std::string, int> const scores{{"a", 1}};
+
+        auto getShared = v8wrap::Function::newFunction([]() { return v8wrap::bind::ContainerRef{&shared}; });
+        auto getScores = v8wrap::Function::newFunction([]() { return v8wrap::bind::ContainerRef{&scores}; });
+        rt->getGlobalThis().set("getShared", getShared);
+        rt->getGlobalThis().set("getScores", getScores);
+
+        rt->eval("const s = getShared(); s[1] = 21; s[s.length] = 40;");
+        REQUIRE(shared == std::vector<int>{10, 21, 30, 40});
+        REQUIRE(rt->eval("s.map(x => x * 2).join(',')").asString().getValue() == "20,42,60,80");
+        REQUIRE(rt->eval("Object.keys(s).length").asNumber().getInt32() == 4);
+
+        shared.push_back(50); // C++ side changes are visible without re-fetching
+        REQUIRE(rt->eval("s.length + ':' + s[4]").asString().getValue() == "5:50");
+
+        REQUIRE_THROWS_MATCHES(
+            rt->eval("s[10] = 1"),
+            v8wrap::Exception,
+            Catch::Matchers::ExceptionMessageMatcher("Uncaught RangeError: Container index out of range")
+        );
+
+        REQUIRE(rt->eval("const m = getScores(); m.a + ':' + ('b' in m)").asString().getValue() == "1:false");
+        REQUIRE_THROWS_MATCHES(
+            rt->eval("m.b = 2"),
+            v8wrap::Exception,
+            Catch::Matchers::ExceptionMessageMatcher("Uncaught TypeError: Container is read-only")
+        );
+    }
+
+    SECTION("Container members by reference") {
+        REQUIRE_NOTHROW(rt->registerClass(UUIDBind));
+        REQUIRE_NOTHROW(rt->registerClass(InventoryBind));
+
+        auto native = new Inventory{};
+        auto inv    = rt->newInstanceOfRaw(InventoryBind, native);
+        rt->getGlobalThis().set("inv", inv);
+
+        rt->eval("inv.slots[0] = 7; inv.slots.push(4); inv.tags.color = 'red'; delete inv.tags.kind;");
+        REQUIRE(native->slots_ == std::vector<int>{7, 2, 3, 4});
+        REQUIRE(native->tags_ == std::unordered_map<std::string, std::string>{{"color", "red"}});
+        REQUIRE(rt->eval("Object.keys(inv.tags).join(',')").asString().getValue() == "color");
+
+        rt->eval("inv.slots = [9];");
+        REQUIRE(native->slots_ == std::vector<int>{9});
+
+        REQUIRE(rt->eval("inv.owner.getUUID()").asString().getValue() == "owner-1");
+        rt->eval("inv.owner.setUUID('owner-2');");
+        REQUIRE(native->owner_.str_id_ == "owner-2");
+
+        // 没有整体 TypeConverter 的容器只读绑定，仍可原地修改
+        rt->eval("inv.queue[0] = 7; inv.queue.push(8); inv.counts.b = 2;");
+        REQUIRE(native->queue_ == std::deque<int>{7, 6, 8});
+        REQUIRE(native->counts_ == std::map<std::string, int>{{"a", 1}, {"b", 2}});
+        REQUIRE_THROWS_AS(rt->eval("'use strict'; inv.queue = [1];"), v8wrap::Exception);
+        REQUIRE(native->queue_ == std::deque<int>{7, 6, 8});
+    }
+}
+
+
+class Counter {
+public:
+    int32_t     count_{0};
+    std::string label_;
+    int32_t const step_{1};
+
+    Counter() = default;
+
+    int32_t add(int32_t value) {
+        count_ += value * step_;
+        return count_;
+    }
+
+    std::string describe(std::string const& prefix) const { return prefix + label_ + std::to_string(count_); }
+
+    Counter& reset() {
+        count_ = 0;
+        return *this;
+    }
+
+    static int32_t twice(int32_t value) { return value * 2; }
+};
+
+v8wrap::bind::meta::ClassDefine CounterBind = v8wrap::bind::defineClass<Counter>("Counter")
+                                                  .constructor<>()
+                                                  .instanceMethod<&Counter::add>("add")
+                                                  .instanceMethod<&Counter::describe>("describe")
+                                                  .instanceMethod<&Counter::reset>("reset")
+                                                  .instanceProperty<&Counter::count_>("count")
+                                                  .instanceProperty<&Counter::label_>("label")
+                                                  .instanceProperty<&Counter::step_>("step")
+                                                  .function<&Counter::twice>("twice")
+                                                  .build();
+
+v8wrap::bind::meta::ClassDefine DynamicCounterBind = v8wrap::bind::defineClass<Counter>("DynamicCounter")
+                                                         .constructor<>()
+                                                         .instanceMethod("add", &Counter::add)
+                                                         .instanceProperty("count", &Counter::count_)
+                                                         .build();
+
+TEST_CASE_METHOD(BindingTestFixture, "Compile-time trampolines") {
+    v8wrap::EngineScope enter{rt};
+
+    REQUIRE_NOTHROW(rt->registerClass(CounterBind));
+
+    auto find = [](auto const& list, std::string_view name) {
+        return std::find_if(list.begin(), list.end(), [&](auto const& item) { return item.name_ == name; });
+    };
+    REQUIRE(find(CounterBind.instanceMemberDef_.methods_, "add")->trampoline_ != nullptr);
+    REQUIRE(find(CounterBind.instanceMemberDef_.property_, "count")->setterTrampoline_ != nullptr);
+    REQUIRE(find(CounterBind.instanceMemberDef_.property_, "step")->setterTrampoline_ == nullptr);
+    REQUIRE(find(CounterBind.staticMemberDef_.functions_, "twice")->trampoline_ != nullptr);
+    // std::function 回调仍然生成，供动态调用
+    REQUIRE(find(CounterBind.instanceMemberDef_.methods_, "add")->callback_ != nullptr);
+
+    auto value = rt->eval(R"(
+        const c = new Counter();
+        c.label = 'n=';
+        for (let i = 0; i < 10; ++i) c.add(i);
+        c.describe('counter ') + '|' + c.count + '|' + c.step + '|' + Counter.twice(21);
+    )");
+    REQUIRE(value.asString().getValue() == "counter n=45|45|1|42");
+
+    REQUIRE(rt->eval("c.reset() === c && c.count === 0").asBoolean().getValue());
+    REQUIRE(rt->eval("c.count = 5; c.add(1)").asNumber().getInt32() == 6);
+
+    REQUIRE_THROWS_MATCHES(
+        rt->eval("c.add();"),
+        v8wrap::Exception,
+        Catch::Matchers::ExceptionMessageMatcher("Uncaught TypeError: argument count mismatch")
+    );
+    REQUIRE_THROWS_MATCHES(
+        rt->eval("Counter.twice(1, 2);"),
+        v8wrap::Exception,
+        Catch::Matchers::ExceptionMessageMatcher("Uncaught TypeError: argument count mismatch")
+    );
+    REQUIRE_THROWS_AS(rt->eval("'use strict'; c.step = 2;"), v8wrap::Exception); // const 成员只读
+}
+
+TEST_CASE_METHOD(BindingTestFixture, "Compile-time trampolines benchmark", "[!benchmark]") {
+    v8wrap::EngineScope enter{rt};
+
+    rt->registerClass(CounterBind);
+    rt->registerClass(DynamicCounterBind);
+
+    BENCHMARK("std::function method + property") {
+        return rt->eval("{ const c = new DynamicCounter(); for (let i = 0; i < 100000; ++i) c.add((c.count & 1) + 1); }");
+    };
+
+    BENCHMARK("trampoline method + property") {
+        return rt->eval("{ const c = new Counter(); for (let i = 0; i < 100000; ++i) c.add((c.count & 1) + 1); }");
+    };
+}
+
+
+int32_t       TableCounterCreated = 0;
+int32_t const TableCounterLimit   = 100;
+
+constexpr auto TableCounterTable = v8wrap::bind::defineClassTable<Counter>("TableCounter")
+                                       .constructor<>()
+                                       .instanceMethod<&Counter::add>("add")
+                                       .instanceMethod<&Counter::describe>("describe")
+                                       .instanceProperty<&Counter::count_>("count")
+                                       .instanceProperty<&Counter::step_>("step")
+                                       .function<&Counter::twice>("twice")
+                                       .property<&TableCounterCreated>("created")
+                                       .property<&TableCounterLimit>("limit")
+                                       .build();
+
+constinit v8wrap::bind::meta::ClassDefine const TableCounterBind{TableCounterTable};
+
+constexpr auto TableMathTable =
+    v8wrap::bind::defineClassTable<void>("TableMath").function<&Counter::twice>("twice").build();
+
+constinit v8wrap::bind::meta::ClassDefine const TableMathBind{TableMathTable};
+
+static_assert(TableCounterTable.instanceMethods_.size() == 2 && TableCounterTable.staticProperty_.size() == 2);
+static_assert(TableCounterTable.name_ == "TableCounter" && TableCounterTable.classSize_ == sizeof(Counter));
+static_assert(TableMathTable.instanceMethods_.empty() && TableMathTable.constructor_ == nullptr);
+
+TEST_CASE_METHOD(BindingTestFixture, "Static-storage ClassDefine") {
+    v8wrap::EngineScope enter{rt};
+
+    REQUIRE(TableCounterBind.hasConstructor());
+    REQUIRE(TableCounterBind.instanceMemberDef_.methods_.data() == TableCounterTable.instanceMethods_.data());
+    REQUIRE_NOTHROW(rt->registerClass(TableCounterBind));
+    REQUIRE_NOTHROW(rt->registerClass(TableMathBind));
+
+    auto value = rt->eval(R"(
+        const t = new TableCounter();
+        for (let i = 0; i < 10; ++i) t.add(i);
+        t.count = t.count + 1;
+        t.describe('n=') + '|' + t.step + '|' + TableCounter.twice(21) + '|' + TableMath.twice(2);
+    )");
+    REQUIRE(value.asString().getValue() == "n=46|1|42|4");
+    REQUIRE(rt->eval("t instanceof TableCounter").asBoolean().getValue());
+
+    TableCounterCreated = 3;
+    REQUIRE(rt->eval("TableCounter.created + TableCounter.limit").asNumber().getInt32() == 103);
+    rt->eval("TableCounter.created = 7;");
+    REQUIRE(TableCounterCreated == 7);
+    REQUIRE_THROWS_AS(rt->eval("'use strict'; TableCounter.limit = 1;"), v8wrap::Exception);
+    REQUIRE_THROWS_AS(rt->eval("'use strict'; t.step = 2;"), v8wrap::Exception);
+
+    auto instance = rt->newInstanceOfRaw(TableCounterBind, new Counter{});
+    REQUIRE(rt->isInstanceOf(instance, TableCounterBind));
+
+    REQUIRE_THROWS_AS(rt->eval("new TableMath();"), v8wrap::Exception); // 静态类不可构造
+}
+
+
+namespace primitives {
+int32_t  addInt(int32_t a, int32_t b) { return a + b; }
+uint32_t addUint(uint32_t a, uint32_t b) { return a + b; }
+uint8_t  toByte(uint8_t value) { return value; }
+double   half(double value) { return value / 2; }
+float    halfFloat(float value) { return value / 2; }
+bool     negate(bool value) { return !value; }
+int32_t  truncate(int32_t value) { return value; }
+} // namespace primitives
+
+v8wrap::bind::meta::ClassDefine PrimitivesBind = v8wrap::bind::defineClass<void>("Primitives")
+                                                     .function<&primitives::addInt>("addInt")
+                                                     .function<&primitives::addUint>("addUint")
+                                                     .function<&primitives::toByte>("toByte")
+                                                     .function<&primitives::half>("half")
+                                                     .function<&primitives::halfFloat>("halfFloat")
+                                                     .function<&primitives::negate>("negate")
+                                                     .function<&primitives::truncate>("truncate")
+                                                     .function("dynamicAddInt", &primitives::addInt)
+                                                     .build();
+
+TEST_CASE_METHOD(BindingTestFixture, "Primitive argument and return fast paths") {
+    v8wrap::EngineScope enter{rt};
+    rt->registerClass(PrimitivesBind);
+
+    REQUIRE(rt->eval("Primitives.addInt(2, 3)").asNumber().getInt32() == 5);
+    REQUIRE(rt->eval("Primitives.addInt(-7, 3)").asNumber().getInt32() == -4);
+    REQUIRE(rt->eval("Primitives.dynamicAddInt(-7, 3)").asNumber().getInt32() == -4);
+    REQUIRE(rt->eval("Primitives.truncate(2.9)").asNumber().getInt32() == 2); // 非整数按 double 截断
+    REQUIRE(rt->eval("Primitives.truncate(-2.9)").asNumber().getInt32() == -2);
+
+    // uint32 超出 int32 范围时返回值仍为正数
+    REQUIRE(rt->eval("Primitives.addUint(4000000000, 1)").asNumber().getDouble() == 4000000001.0);
+    REQUIRE(rt->eval("Primitives.addUint(4294967295, 0) === 4294967295").asBoolean().getValue());
+    REQUIRE(rt->eval("Primitives.toByte(300)").asNumber().getInt32() == 44);
+
+    REQUIRE(rt->eval("Primitives.half(5)").asNumber().getDouble() == 2.5);
+    REQUIRE(rt->eval("Primitives.halfFloat(3)").asNumber().getDouble() == 1.5);
+    REQUIRE(rt->eval("Primitives.negate(false)").asBoolean().getValue());
+    REQUIRE(rt->eval("typeof Primitives.addInt(1, 1) === 'number'").asBoolean().getValue());
+
+    REQUIRE_THROWS_MATCHES(
+        rt->eval("Primitives.addInt('1', 2)"),
+        v8wrap::Exception,
+        Catch::Matchers::ExceptionMessageMatcher("Uncaught Error: cannot convert to Number")
+    );
+    REQUIRE_THROWS_MATCHES(
+        rt->eval("Primitives.negate(0)"),
+        v8wrap::Exception,
+        Catch::Matchers::ExceptionMessageMatcher("Uncaught Error: cannot convert to Boolean")
+    );
+}
+
+TEST_CASE_METHOD(BindingTestFixture, "Primitive fast paths benchmark", "[!benchmark]") {
+    v8wrap::EngineScope enter{rt};
+    rt->registerClass(PrimitivesBind);
+
+    BENCHMARK("int32 add") {
+        return rt->eval("{ let s = 0; for (let i = 0; i < 100000; ++i) s = Primitives.addInt(s & 0xffff, i); }");
+    };
+
+    BENCHMARK("double half") {
+        return rt->eval("{ let s = 0; for (let i = 0; i < 100000; ++i) s += Primitives.half(i); }");
+    };
+}
+
+
+namespace converters {
+struct Vec {
+    double x_;
+    double y_;
+
+    Vec(double x, double y) : x_(x), y_(y) {}
+};
+} // namespace converters
+
+v8wrap::bind::meta::ClassDefine VecBind = v8wrap::bind::defineClass<converters::Vec>("Vec")
+                                              .constructor<double, double>()
+                                              .instanceProperty("x", &converters::Vec::x_)
+                                              .instanceProperty("y", &converters::Vec::y_)
+                                              .build();
+
+template <>
+struct v8wrap::bind::TypeConverter<converters::Vec> : v8wrap::bind::ClassConverter<converters::Vec, VecBind> {};
+
+TEST_CASE_METHOD(BindingTestFixture, "Predicate-based conversion") {
+    v8wrap::EngineScope enter{rt};
+    rt->registerClass(VecBind);
+
+    using Choice = std::variant<int, std::string, converters::Vec*, std::vector<int>, std::monostate>;
+
+    SECTION("canConvert") {
+        using v8wrap::bind::CanConvertToCpp;
+        REQUIRE(CanConvertToCpp<converters::Vec*>(rt->eval("new Vec(1, 2)")));
+        REQUIRE_FALSE(CanConvertToCpp<converters::Vec*>(rt->eval("({ x: 1, y: 2 })")));
+        REQUIRE_FALSE(CanConvertToCpp<converters::Vec*>(rt->eval("1")));
+        REQUIRE(CanConvertToCpp<std::optional<converters::Vec*>>(rt->eval("null")));
+        REQUIRE(CanConvertToCpp<std::pair<int, int>>(rt->eval("[1, 2]")));
+        REQUIRE_FALSE(CanConvertToCpp<std::pair<int, int>>(rt->eval("[1]")));
+        REQUIRE(CanConvertToCpp<Choice>(rt->eval("[1]")));
+        REQUIRE_FALSE(CanConvertToCpp<Choice>(rt->eval("true")));
+        REQUIRE_FALSE(CanConvertToCpp<std::variant<bool, std::string>>(rt->eval("1")));
+
+        // 实例已被销毁 (accessor 返回 nullptr)：不可转换，toCpp 抛出 TypeError
+        static int released  = 0;
+        auto       destroyed = rt->newInstance(
+            VecBind,
+            v8wrap::bind::JsManagedResource::make(&released, [](void*) -> void* { return nullptr; }, nullptr)
+        );
+        REQUIRE(rt->isInstanceOf(destroyed, VecBind));
+        REQUIRE_FALSE(CanConvertToCpp<converters::Vec*>(destroyed));
+        REQUIRE_THROWS_MATCHES(
+            v8wrap::bind::ConvertToCpp<converters::Vec*>(destroyed),
+            v8wrap::Exception,
+            Catch::Matchers::ExceptionMessageMatcher("instance has been destroyed")
+        );
+    }
+
+    SECTION("variant and optional pick the alternative by predicate") {
+        auto kind = v8wrap::Function::newFunction([](Choice const& value) -> std::string {
+            switch (value.index()) {
+            case 0:
+                return "int:" + std::to_string(std::get<0>(value));
+            case 1:
+                return "string:" + std::get<1>(value);
+            case 2:
+                return "vec:" + std::to_string(static_cast<int>(std::get<2>(value)->x_));
+            case 3:
+                return "array:" + std::to_string(std::get<3>(value).size());
+            default:
+                return "none";
+            }
+        });
+        rt->getGlobalThis().set(v8wrap::String::newString("kind"), kind);
+
+        REQUIRE(rt->eval("kind(7)").asString().getValue() == "int:7");
+        REQUIRE(rt->eval("kind('s')").asString().getValue() == "string:s");
+        REQUIRE(rt->eval("kind(new Vec(3, 4))").asString().getValue() == "vec:3");
+        REQUIRE(rt->eval("kind([1, 2, 3])").asString().getValue() == "array:3");
+        REQUIRE(rt->eval("kind(undefined)").asString().getValue() == "none");
+        REQUIRE_THROWS_AS(rt->eval("kind({})"), v8wrap::Exception);
+
+        auto number = v8wrap::Function::newFunction([](std::variant<int64_t, double> const& value) {
+            return std::holds_alternative<int64_t>(value) ? std::string{"integer"} : std::string{"double"};
+        });
+        rt->getGlobalThis().set(v8wrap::String::newString("number"), number);
+        REQUIRE(rt->eval("number(2)").asString().getValue() == "integer");
+        REQUIRE(rt->eval("number(2n)").asString().getValue() == "integer");
+        REQUIRE(rt->eval("number(2.5)").asString().getValue() == "double");
+
+        auto length = v8wrap::Function::newFunction([](std::optional<converters::Vec*> value) {
+            return value ? (*value)->x_ + (*value)->y_ : -1.0;
+        });
+        rt->getGlobalThis().set(v8wrap::String::newString("length"), length);
+        REQUIRE(rt->eval("length(new Vec(1, 2))").asNumber().getDouble() == 3.0);
+        REQUIRE(rt->eval("length(null)").asNumber().getDouble() == -1.0);
+        REQUIRE_THROWS_AS(rt->eval("length({ x: 1, y: 2 })"), v8wrap::Exception);
+    }
+
+    SECTION("overloads resolve bound classes by instance check") {
+        auto describe = v8wrap::Function::newFunction(
+            [](converters::Vec const& vec) { return "vec:" + std::to_string(static_cast<int>(vec.y_)); },
+            [](std::unordered_map<std::string, int> const& object) { return "object:" + std::to_string(object.size()); }
+        );
+        rt->getGlobalThis().set(v8wrap::String::newString("describe"), describe);
+
+        REQUIRE(rt->eval("describe(new Vec(1, 5))").asString().getValue() == "vec:5");
+        REQUIRE(rt->eval("describe({ a: 1, b: 2 })").asString().getValue() == "object:2");
+    }
+}
+
+
+namespace defaults {
+std::string format(double value, int precision, std::string const& unit) {
+    auto text = std::to_string(value); // truncates, enough for the test
+    return text.substr(0, text.find('.') + (precision > 0 ? precision + 1 : 0)) + unit;
+}
+
+int sum(int a, std::optional<int> b, std::optional<int> c) { return a + b.value_or(0) + c.value_or(0); }
+
+struct Greeter {
+    std::string prefix_{"Hello"};
+
+    Greeter() = default;
+
+    std::string greet(std::string const& name, std::string const& punctuation) const {
+        return prefix_ + ", " + name + punctuation;
+    }
+
+    int scale(int value, std::optional<int> factor) const { return value * factor.value_or(10); }
+};
+} // namespace defaults
+
+v8wrap::bind::meta::ClassDefine GreeterBind =
+    v8wrap::bind::defineClass<defaults::Greeter>("Greeter")
+        .constructor<>()
+        .instanceMethod("greet", v8wrap::bind::withDefaults(&defaults::Greeter::greet, std::string{"!"}))
+        .instanceMethod<&defaults::Greeter::scale>("scale")
+        .function("format", v8wrap::bind::withDefaults(&defaults::format, 2, std::string{"px"}))
+        .function<&defaults::sum>("sum")
+        .build();
+
+TEST_CASE_METHOD(BindingTestFixture, "Default and optional arguments") {
+    v8wrap::EngineScope enter{rt};
+    rt->registerClass(GreeterBind);
+
+    SECTION("ClassDefineBuilder") {
+        REQUIRE(rt->eval("Greeter.format(1.2345)").asString().getValue() == "1.23px");
+        REQUIRE(rt->eval("Greeter.format(1.2345, 1)").asString().getValue() == "1.2px");
+        REQUIRE(rt->eval("Greeter.format(1.2345, 0, '%')").asString().getValue() == "1%");
+        REQUIRE_THROWS_AS(rt->eval("Greeter.format()"), v8wrap::Exception);
+        REQUIRE_THROWS_AS(rt->eval("Greeter.format(1, 2, 'x', 4)"), v8wrap::Exception);
+
+        REQUIRE(rt->eval("Greeter.sum(1)").asNumber().getInt32() == 1);
+        REQUIRE(rt->eval("Greeter.sum(1, 2)").asNumber().getInt32() == 3);
+        REQUIRE(rt->eval("Greeter.sum(1, undefined, 3)").asNumber().getInt32() == 4);
+
+        REQUIRE(rt->eval("new Greeter().greet('v8')").asString().getValue() == "Hello, v8!");
+        REQUIRE(rt->eval("new Greeter().greet('v8', '?')").asString().getValue() == "Hello, v8?");
+        REQUIRE(rt->eval("new Greeter().scale(4)").asNumber().getInt32() == 40);
+        REQUIRE(rt->eval("new Greeter().scale(4, 2)").asNumber().getInt32() == 8);
+    }
+
+    SECTION("Function::newFunction") {
+        auto clamp = v8wrap::Function::newFunction(v8wrap::bind::withDefaults(
+            [](double value, double low, double high) { return value < low ? low : (value > high ? high : value); },
+            0.0,
+            1.0
+        ));
+        rt->getGlobalThis().set(v8wrap::String::newString("clamp"), clamp);
+        REQUIRE(rt->eval("clamp(2)").asNumber().getDouble() == 1.0);
+        REQUIRE(rt->eval("clamp(-2, -1)").asNumber().getDouble() == -1.0);
+        REQUIRE(rt->eval("clamp(5, 0, 10)").asNumber().getDouble() == 5.0);
+
+        auto join = v8wrap::Function::newFunction([](std::string a, std::optional<std::string> b) {
+            return a + b.value_or("-");
+        });
+        rt->getGlobalThis().set(v8wrap::String::newString("join"), join);
+        REQUIRE(rt->eval("join('a')").asString().getValue() == "a-");
+        REQUIRE(rt->eval("join('a', 'b')").asString().getValue() == "ab");
+    }
+
+    SECTION("Overloads with omittable arguments") {
+        auto pick = v8wrap::Function::newFunction(
+            [](std::string const& s, std::optional<int> n) { return s + std::to_string(n.value_or(0)); },
+            v8wrap::bind::withDefaults([](int a, int b) { return a + b; }, 100)
+        );
+        rt->getGlobalThis().set(v8wrap::String::newString("pick"), pick);
+        REQUIRE(rt->eval("pick('x')").asString().getValue() == "x0");
+        REQUIRE(rt->eval("pick('x', 2)").asString().getValue() == "x2");
+        REQUIRE(rt->eval("pick(1)").asNumber().getInt32() == 101);
+        REQUIRE(rt->eval("pick(1, 2)").asNumber().getInt32() == 3);
+    }
+}
@@ -0,0 +1,2 @@
+// 仅包含 ClassDefineBuilder.h，检查其可作为首个头文件独立编译 (TypeConverter.h 与 FunctionAdapter.h 之间存在包含环)
+#include "v8wrap/bind/builder/ClassDefineBuilder.h"
@@ -1,3 +1,4 @@
+#include "catch2/benchmark/catch_benchmark.hpp"
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers.hpp"
 #include "catch2/matchers/catch_matchers_exception.hpp"
@@ -8,6 +9,8 @@
 #include "v8wrap/runtime/Platform.h"
 #include "v8wrap/types/Value.h"
 
+#include <string>
+
 
 using Catch::Matchers::MessageMatches;
 
@@ -28,4 +31,110 @@ TEST_CASE("Exception") {
             CHECK(e.message() == "test exception");
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("ErrorScope") {
+    auto rt = v8wrap::Platform::getInstance().newEngine();
+
+    {
+        v8wrap::EngineScope scope(rt);
+
+        auto obj = rt->eval("({ get bad() { throw new Error('boom'); }, ok: 1 })").asObject();
+
+        {
+            v8wrap::ErrorScope errors;
+            REQUIRE(obj.get("ok").asNumber().getInt32() == 1);
+            REQUIRE_FALSE(errors.hasError());
+
+            REQUIRE(obj.get("bad").isUndefined()); // recorded, not thrown
+            REQUIRE(errors.hasError());
+            REQUIRE(obj.get("ok").isUndefined()); // skipped after the first failure
+            REQUIRE_THROWS_MATCHES(errors.rethrow(), v8wrap::Exception, MessageMatches("Uncaught Error: boom"));
+
+            REQUIRE_FALSE(errors.hasError()); // usable again after rethrow
+            REQUIRE(obj.get("ok").asNumber().getInt32() == 1);
+        }
+
+        // unhandled errors surface when the scope ends
+        REQUIRE_THROWS_AS(
+            [&] {
+                v8wrap::ErrorScope errors;
+                (void)rt->eval("(function () { throw new Error('late'); })").asFunction().call({});
+            }(),
+            v8wrap::Exception
+        );
+
+        // outside an ErrorScope every operation still throws on its own
+        REQUIRE_THROWS_AS(obj.get("bad"), v8wrap::Exception);
+
+        // native callbacks re-entered from Js are not affected by the outer scope
+        auto native = v8wrap::Function::newFunction([&obj]() -> int {
+            try {
+                (void)obj.get("bad");
+            } catch (v8wrap::Exception const&) {
+                return -1;
+            }
+            return 0;
+        });
+        {
+            v8wrap::ErrorScope errors;
+            REQUIRE(native.call({}).asNumber().getInt32() == -1);
+            REQUIRE_FALSE(errors.hasError());
+        }
+    }
+
+    v8wrap::Platform::getInstance().destroyEngine(rt);
+}
+
+TEST_CASE("ErrorScope benchmark", "[!benchmark]") {
+    auto rt = v8wrap::Platform::getInstance().newEngine();
+
+    {
+        v8wrap::EngineScope scope(rt);
+
+        constexpr size_t count = 100'000;
+
+        auto obj   = v8wrap::Object::newObject();
+        auto array = v8wrap::Array::newArray(count);
+        auto key   = v8wrap::String::newString("value");
+
+        // 每次迭代在独立的 HandleScope 中创建句柄，避免句柄在外层 scope 中累积
+        BENCHMARK("Object get/set per-operation TryCatch") {
+            v8::HandleScope handles{rt->isolate()};
+            for (size_t i = 0; i < count; ++i) {
+                obj.set(key, v8wrap::Number::newNumber(static_cast<double>(i)));
+                (void)obj.get(key);
+            }
+            return obj.get(key).isNumber();
+        };
+
+        BENCHMARK("Object get/set in ErrorScope") {
+            v8::HandleScope    handles{rt->isolate()};
+            v8wrap::ErrorScope errors;
+            for (size_t i = 0; i < count; ++i) {
+                obj.set(key, v8wrap::Number::newNumber(static_cast<double>(i)));
+                (void)obj.get(key);
+            }
+            return obj.get(key).isNumber();
+        };
+
+        BENCHMARK("Array set/get per-operation TryCatch") {
+            v8::HandleScope handles{rt->isolate()};
+            for (size_t i = 0; i < count; ++i) {
+                array.set(i, array.get(count - 1 - i));
+            }
+            return array.length();
+        };
+
+        BENCHMARK("Array set/get in ErrorScope") {
+            v8::HandleScope    handles{rt->isolate()};
+            v8wrap::ErrorScope errors;
+            for (size_t i = 0; i < count; ++i) {
+                array.set(i, array.get(count - 1 - i));
+            }
+            return array.length();
+        };
+    }
+
+    v8wrap::Platform::getInstance().destroyEngine(rt);
+}
@@ -6,7 +6,14 @@
 #include "v8wrap/runtime/Platform.h"
 #include "v8wrap/types/Value.h"
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 
 struct JsValueTestFixture {
@@ -71,6 +78,40 @@ TEST_CASE_METHOD(JsValueTestFixture, "String") {
         CHECK(str.getValue() == "Hello, World!");
         CHECK(str.length() == 13);
     }
+    SECTION("External") {
+        std::string payload(4096, 'x');
+        payload.back() = 'y';
+        auto adopted   = v8wrap::String::newString(std::move(payload));
+        CHECK(adopted.length() == 4096);
+        CHECK(adopted.getValue().back() == 'y');
+
+        std::string unicode = std::string(512, 'a') + "\xE4\xBD\xA0"; // non-ASCII tail falls back to UTF-8 copy
+        auto        copied  = v8wrap::String::newString(std::move(unicode));
+        CHECK(copied.length() == 513);
+
+        auto literal = v8wrap::String::newStaticString("static name");
+        CHECK(literal.getValue() == "static name");
+        CHECK(v8wrap::String::newStaticString("").length() == 0);
+
+        static std::string const banner(300, '='); // long enough to be referenced as an external string
+        CHECK(v8wrap::String::newStaticString(banner).getValue() == banner);
+    }
+    SECTION("UTF-16 and Latin-1") {
+        auto u16 = v8wrap::String::newString(u"你好, world");
+        CHECK(u16.length() == 9);
+        CHECK(u16.getU16Value() == u"你好, world");
+        CHECK(u16.getValue() == "你好, world");
+        CHECK_FALSE(u16.isOneByte());
+        CHECK_THROWS_AS(u16.getLatin1Value(), v8wrap::Exception);
+
+        auto latin1 = v8wrap::String::newLatin1String("caf\xE9");
+        CHECK(latin1.length() == 4);
+        CHECK(latin1.isOneByte());
+        CHECK(latin1.getLatin1Value() == "caf\xE9");
+        CHECK(latin1.getValue() == "café"); // one-byte fast path still yields UTF-8
+        CHECK(latin1.getU16Value() == u"café");
+        CHECK(v8wrap::String::newString("café").getLatin1Value() == "caf\xE9");
+    }
 }
 
 TEST_CASE_METHOD(JsValueTestFixture, "Symbol") {
@@ -173,6 +214,22 @@ TEST_CASE_METHOD(JsValueTestFixture, "Object") {
         CHECK(obj.has(key) == false);
     }
 
+    SECTION("Interned Keys") {
+        auto obj = v8wrap::Object::newObject();
+        obj.set("position", v8wrap::Number::newNumber(1));
+        CHECK(obj.has("position"));
+        CHECK(obj.get(rt->intern("position")).asNumber().getInt32() == 1);
+        CHECK(obj.get(rt->intern<"position">()).asNumber().getInt32() == 1);
+        CHECK(rt->intern<"position">() == rt->intern("position"));
+        CHECK(rt->intern<"position">().getValue() == "position");
+
+        obj.remove("position");
+        CHECK_FALSE(obj.has("position"));
+
+        rt->setVauleToGlobalThis("internedGlobal", v8wrap::Number::newNumber(2));
+        CHECK(rt->getVauleFromGlobalThis("internedGlobal").asNumber().getInt32() == 2);
+    }
+
     SECTION("Instance Check") {
         auto obj         = v8wrap::Object::newObject();
         auto constructor = v8wrap::Object::newObject();
@@ -243,6 +300,28 @@ TEST_CASE_METHOD(JsValueTestFixture, "Array") {
             CHECK(arr.get(i).asNumber().getInt32() == static_cast<int>(i));
         }
     }
+
+    SECTION("Bulk Elements") {
+        std::vector<v8wrap::Local<v8wrap::Value>> elements{
+            v8wrap::Number::newNumber(1),
+            v8wrap::String::newString("two"),
+            v8wrap::Boolean::newBoolean(true)
+        };
+        auto arr = v8wrap::Array::newArray(elements);
+        CHECK(arr.length() == 3);
+        CHECK(arr.get(1).asString().getValue() == "two");
+
+        auto values = arr.toVector();
+        REQUIRE(values.size() == 3);
+        CHECK(values[0].asNumber().getInt32() == 1);
+        CHECK(values[1].asString().getValue() == "two");
+        CHECK(values[2].asBoolean().getValue());
+
+        // holes are reported as undefined
+        auto sparse = v8wrap::Array::newArray(2).toVector();
+        REQUIRE(sparse.size() == 2);
+        CHECK(sparse[0].isUndefined());
+    }
 }
 
 TEST_CASE_METHOD(JsValueTestFixture, "Array Boundary Tests") {
@@ -261,4 +340,188 @@ TEST_CASE_METHOD(JsValueTestFixture, "Array Boundary Tests") {
         arr.set(0, v8wrap::Number::newNumber(42));
         CHECK(arr.get(0).asNumber().getInt32() == 42);
     }
-}
\ No newline at end of file
+}
+TEST_CASE_METHOD(JsValueTestFixture, "ArrayBuffer and TypedArray") {
+    v8wrap::EngineScope enter(rt);
+
+    SECTION("ArrayBuffer") {
+        uint8_t raw[4] = {1, 2, 3, 4};
+        auto    buffer = v8wrap::ArrayBuffer::newArrayBuffer(raw, sizeof(raw));
+        CHECK(buffer.byteLength() == 4);
+        CHECK(buffer.data() != raw); // copied
+        CHECK(static_cast<uint8_t*>(buffer.data())[3] == 4);
+        CHECK(buffer.asValue().getType() == v8wrap::ValueType::ArrayBuffer);
+
+        auto external = v8wrap::ArrayBuffer::newExternal(raw, sizeof(raw));
+        CHECK(external.data() == raw); // borrowed
+    }
+
+    SECTION("TypedArray view") {
+        auto buffer = v8wrap::ArrayBuffer::newArrayBuffer(16);
+        auto floats = v8wrap::TypedArray::newTypedArray(v8wrap::TypedArrayType::Float32, buffer, 4, 3);
+        CHECK(floats.type() == v8wrap::TypedArrayType::Float32);
+        CHECK(floats.length() == 3);
+        CHECK(floats.byteOffset() == 4);
+        CHECK(floats.byteLength() == 12);
+        CHECK(floats.data() == static_cast<std::byte*>(buffer.data()) + 4);
+        CHECK(floats.asValue().getType() == v8wrap::ValueType::TypedArray);
+
+        CHECK_THROWS_AS(
+            v8wrap::TypedArray::newTypedArray(v8wrap::TypedArrayType::Float64, buffer, 8, 2),
+            v8wrap::Exception
+        );
+        // byteOffset + length * elementSize 溢出后不能绕过边界检查
+        constexpr auto huge = std::numeric_limits<size_t>::max();
+        CHECK_THROWS_AS(
+            v8wrap::TypedArray::newTypedArray(v8wrap::TypedArrayType::Float32, buffer, 4, huge / 4 + 1),
+            v8wrap::Exception
+        );
+        CHECK_THROWS_AS(
+            v8wrap::TypedArray::newTypedArray(v8wrap::TypedArrayType::Uint8, buffer, 32, 0),
+            v8wrap::Exception
+        );
+    }
+
+    SECTION("DataView") {
+        auto buffer = v8wrap::ArrayBuffer::newArrayBuffer(8);
+        auto view   = v8wrap::DataView::newDataView(buffer, 2, 4);
+        CHECK(view.byteLength() == 4);
+        CHECK(view.data() == static_cast<std::byte*>(buffer.data()) + 2);
+        CHECK(view.asValue().isDataView());
+        CHECK(view.asValue().getType() == v8wrap::ValueType::DataView);
+
+        CHECK_THROWS_AS(v8wrap::DataView::newDataView(buffer, 4, std::numeric_limits<size_t>::max()), v8wrap::Exception);
+        CHECK_THROWS_AS(v8wrap::DataView::newDataView(buffer, 9, 0), v8wrap::Exception);
+    }
+}
+
+TEST_CASE_METHOD(JsValueTestFixture, "EngineScope re-entrant") {
+    v8wrap::EngineScope enter(rt);
+
+    SECTION("nested scope of the same engine") {
+        auto outer = v8wrap::Object::newObject();
+        {
+            v8wrap::EngineScope nested(rt);
+            CHECK(v8wrap::EngineScope::currentRuntime() == rt);
+            CHECK(v8wrap::EngineScope::currentRuntimeContextChecked() == rt->context());
+            outer.set("inner", v8wrap::Number::newNumber(1));
+        }
+        CHECK(outer.get("inner").asNumber().getInt32() == 1);
+    }
+
+    SECTION("Js -> C++ -> Js") {
+        auto func = v8wrap::Function::newFunction([this](v8wrap::Arguments const& args) {
+            v8wrap::EngineScope nested(rt);
+            return args[0].asFunction().call({}, v8wrap::Number::newNumber(2));
+        });
+        rt->setVauleToGlobalThis("reenter", func);
+        auto value = rt->eval("reenter(x => reenter(y => x + y))");
+        CHECK(value.asNumber().getInt32() == 4);
+    }
+
+    SECTION("ExitEngineScope") {
+        auto value = v8wrap::Number::newNumber(3);
+        {
+            v8wrap::ExitEngineScope exit;
+            CHECK(v8wrap::EngineScope::currentRuntime() == nullptr);
+
+            int32_t result = 0;
+            std::thread{[&] {
+                v8wrap::EngineScope other(rt);
+                result = rt->eval("1 + 2").asNumber().getInt32();
+            }}.join();
+            CHECK(result == 3);
+        }
+        CHECK(v8wrap::EngineScope::currentRuntime() == rt);
+        CHECK(value.getInt32() == 3);
+    }
+}
+
+TEST_CASE("EngineScope single-threaded engine") {
+    auto rt = v8wrap::Platform::getInstance().newEngine(v8wrap::Engine::ThreadMode::SingleThreaded);
+    REQUIRE(rt->isSingleThreaded());
+    {
+        v8wrap::EngineScope enter(rt);
+        CHECK(rt->eval("[1, 2, 3].length").asNumber().getInt32() == 3);
+        {
+            v8wrap::ExitEngineScope exit;
+            v8wrap::EngineScope     again(rt);
+            CHECK(rt->eval("'again'").asString().getValue() == "again");
+        }
+    }
+
+    bool threw = false;
+    std::thread{[&] {
+        try {
+            v8wrap::EngineScope other(rt);
+        } catch (std::logic_error const&) {
+            threw = true;
+        }
+    }}.join();
+    CHECK(threw);
+
+    v8wrap::Platform::getInstance().destroyEngine(rt);
+}
+
+TEST_CASE_METHOD(JsValueTestFixture, "Callbacks entered by external code") {
+    {
+        v8wrap::EngineScope enter(rt);
+        CHECK(v8wrap::Engine::fromIsolate(rt->isolate()) == rt);
+        CHECK(v8wrap::Engine::fromContext(rt->context()) == rt);
+
+        auto func = v8wrap::Function::newFunction([](v8wrap::Arguments const& args) {
+            CHECK(args.runtime() == v8wrap::EngineScope::currentRuntime());
+            return v8wrap::String::newString("native " + args[0].asString().getValue());
+        });
+        rt->setVauleToGlobalThis("external", func);
+    }
+    REQUIRE(v8wrap::EngineScope::currentRuntime() == nullptr);
+
+    // 模拟外部代码 (例如 Node) 直接进入 isolate 调用回调，不经过 EngineScope
+    auto               isolate = rt->isolate();
+    v8::Locker         locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope    handleScope(isolate);
+    auto               context = rt->context();
+    v8::Context::Scope contextScope(context);
+
+    auto fn = context->Global()->Get(context, v8::String::NewFromUtf8Literal(isolate, "external")).ToLocalChecked();
+    v8::Local<v8::Value> argv[] = {v8::String::NewFromUtf8Literal(isolate, "call")};
+    auto result = fn.As<v8::Function>()->Call(context, context->Global(), 1, argv).ToLocalChecked();
+    CHECK(*v8::String::Utf8Value(isolate, result) == std::string{"native call"});
+    CHECK(v8wrap::EngineScope::currentRuntime() == nullptr);
+}
+
+TEST_CASE("Engine keeps embedder data in the isolate data slot") {
+    std::unique_ptr<v8::ArrayBuffer::Allocator> allocator{v8::ArrayBuffer::Allocator::NewDefaultAllocator()};
+    v8::Isolate::CreateParams                   params;
+    params.array_buffer_allocator = allocator.get();
+    auto isolate                  = v8::Isolate::New(params);
+
+    // 模拟嵌入方 (例如 Node) 已占用 v8wrap 使用的数据槽
+    int embedderData = 0;
+    isolate->SetData(V8WRAP_ISOLATE_DATA_SLOT, &embedderData);
+    {
+        v8::Locker         locker(isolate);
+        v8::Isolate::Scope isolateScope(isolate);
+        v8::HandleScope    handleScope(isolate);
+        auto               context = v8::Context::New(isolate);
+
+        auto rt = std::make_unique<v8wrap::Engine>(isolate, context);
+        CHECK(isolate->GetData(V8WRAP_ISOLATE_DATA_SLOT) == &embedderData);
+        {
+            v8wrap::EngineScope enter(rt.get());
+            CHECK(v8wrap::Engine::fromIsolate(isolate) == rt.get());
+
+            auto func = v8wrap::Function::newFunction([](v8wrap::Arguments const& args) {
+                auto isolate = args.runtime()->isolate();
+                return v8wrap::Boolean::newBoolean(v8wrap::Engine::fromIsolate(isolate) == args.runtime());
+            });
+            rt->setVauleToGlobalThis("check", func);
+            CHECK(rt->eval("check()").asBoolean().getValue());
+        }
+        rt.reset();
+        CHECK(isolate->GetData(V8WRAP_ISOLATE_DATA_SLOT) == &embedderData);
+    }
+    isolate->Dispose();
+}
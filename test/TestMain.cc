@@ -1,8 +1,13 @@
 #include "v8wrap/runtime/Platform.h"
 #include <catch2/catch_session.hpp>
 
+#include <v8-initialization.h>
+
 
 int main(int argc, char* argv[]) {
+    // 部分用例使用 %OptimizeFunctionOnNextCall 等 natives 语法强制优化，V8 标志为进程全局状态，须在初始化前统一设置
+    v8::V8::SetFlagsFromString("--allow-natives-syntax");
+
     v8wrap::Platform::getInstance().initialize();
 
     int result = Catch::Session().run(argc, argv);
@@ -1,10 +1,23 @@
+#include "catch2/benchmark/catch_benchmark.hpp"
 #include "catch2/catch_test_macros.hpp"
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <ranges>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
+#include "v8wrap/bind/Stream.h"
 #include "v8wrap/bind/TypeConverter.h"
 #include "v8wrap/runtime/Engine.h"
 #include "v8wrap/runtime/EngineScope.h"
+#include "v8wrap/runtime/Exception.h"
+#include "v8wrap/types/Value.h"
 
 
 TEST_CASE("TypeConverter") {
@@ -23,6 +36,14 @@ TEST_CASE("TypeConverter") {
     REQUIRE(v8wrap::bind::ConvertToCpp<std::string>(v2) == srt);
 
 
+    std::u16string u16 = u"UTF-16 文本";
+    auto           v6  = v8wrap::bind::ConvertToJs(u16);
+    REQUIRE(v6.isString());
+    REQUIRE(v8wrap::bind::ConvertToCpp<std::u16string>(v6) == u16);
+    REQUIRE(v8wrap::bind::ConvertToCpp<std::string>(v6) == "UTF-16 文本");
+    REQUIRE(v8wrap::bind::ConvertToCpp<std::u16string>(v8wrap::bind::ConvertToJs(u"literal")) == u"literal");
+
+
     int  i  = 123;
     auto v3 = v8wrap::bind::ConvertToJs(i);
     REQUIRE(v3.isNumber());
@@ -33,4 +54,368 @@ TEST_CASE("TypeConverter") {
     auto   v4 = v8wrap::bind::ConvertToJs(d);
     REQUIRE(v4.isNumber());
     REQUIRE(v8wrap::bind::ConvertToCpp<double>(v4) == d);
-}
\ No newline at end of file
+
+
+    std::vector<int> vec(1000);
+    std::iota(vec.begin(), vec.end(), 0);
+    auto v5 = v8wrap::bind::ConvertToJs(vec);
+    REQUIRE(v5.isArray());
+    REQUIRE(v5.asArray().length() == vec.size());
+    REQUIRE(v8wrap::bind::ConvertToCpp<std::vector<int>>(v5) == vec);
+
+
+    std::unordered_map<std::string, int> map{
+        {"x", 1},
+        {"y", 2}
+    };
+    auto v7 = v8wrap::bind::ConvertToJs(map);
+    REQUIRE(v7.isObject());
+    REQUIRE(v7.asObject().get("y").asNumber().getInt32() == 2);
+    REQUIRE(v8wrap::bind::ConvertToCpp<std::unordered_map<std::string, int>>(v7) == map);
+}
+
+struct ReflectedPoint {
+    int         x{0};
+    double      y{0};
+    std::string label;
+
+    bool operator==(ReflectedPoint const&) const = default;
+};
+
+template <>
+struct v8wrap::bind::StructFields<ReflectedPoint> {
+    static constexpr auto value = std::make_tuple(
+        V8WRAP_STRUCT_FIELD(ReflectedPoint, x),
+        V8WRAP_STRUCT_FIELD(ReflectedPoint, y),
+        V8WRAP_STRUCT_FIELD(ReflectedPoint, label)
+    );
+};
+
+TEST_CASE("TypeConverter reflected struct") {
+    auto rt = new v8wrap::Engine();
+
+    {
+        v8wrap::EngineScope scope(rt);
+
+        ReflectedPoint point{1, 2.5, "origin"};
+        auto           value = v8wrap::bind::ConvertToJs(point);
+        REQUIRE(value.isObject());
+        REQUIRE(value.asObject().get("x").asNumber().getInt32() == 1);
+        REQUIRE(value.asObject().get("label").asString().getValue() == "origin");
+        REQUIRE(value.asObject().getOwnPropertyNamesAsString() == std::vector<std::string>{"x", "y", "label"});
+        REQUIRE(v8wrap::bind::ConvertToCpp<ReflectedPoint>(value) == point);
+
+        rt->getGlobalThis().set("p", value);
+        auto fromJs = rt->eval("({ label: 'js', y: 4, x: 3 })");
+        REQUIRE(v8wrap::bind::ConvertToCpp<ReflectedPoint>(fromJs) == ReflectedPoint{3, 4, "js"});
+
+        auto shapes = v8wrap::bind::ConvertToJs(std::vector<ReflectedPoint>{point, {7, 8, "b"}});
+        REQUIRE(rt->eval("p.x + p.y").asNumber().getDouble() == 3.5);
+        REQUIRE(v8wrap::bind::ConvertToCpp<std::vector<ReflectedPoint>>(shapes)[1].x == 7);
+    }
+
+    delete rt;
+}
+
+
+TEST_CASE("TypeConverter int64 modes") {
+    using v8wrap::bind::Int64;
+    using v8wrap::bind::Int64Mode;
+
+    auto rt = new v8wrap::Engine();
+
+    {
+        v8wrap::EngineScope scope(rt);
+
+        constexpr int64_t maxSafe = (int64_t{1} << 53) - 1;
+
+        // 默认策略：BigInt，转换为 C++ 时同时接受 BigInt 与整数 Number
+        REQUIRE(v8wrap::bind::ConvertToJs(int64_t{42}).isBigInt());
+        REQUIRE(v8wrap::bind::ConvertToCpp<int64_t>(rt->eval("-42")) == -42);
+        REQUIRE(v8wrap::bind::ConvertToCpp<int64_t>(rt->eval("2 ** 53 - 1")) == maxSafe);
+        REQUIRE(v8wrap::bind::ConvertToCpp<int64_t>(rt->eval("-(2n ** 63n)")) == INT64_MIN);
+        REQUIRE(v8wrap::bind::ConvertToCpp<uint64_t>(rt->eval("2n ** 64n - 1n")) == UINT64_MAX);
+        REQUIRE(v8wrap::bind::ConvertToCpp<uint64_t>(rt->eval("3000000000")) == 3000000000u);
+        REQUIRE_THROWS_AS(v8wrap::bind::ConvertToCpp<int64_t>(rt->eval("1.5")), v8wrap::Exception);
+        REQUIRE_THROWS_AS(v8wrap::bind::ConvertToCpp<int64_t>(rt->eval("2 ** 53")), v8wrap::Exception);
+        REQUIRE_THROWS_AS(v8wrap::bind::ConvertToCpp<int64_t>(rt->eval("2n ** 63n")), v8wrap::Exception);
+        REQUIRE_THROWS_AS(v8wrap::bind::ConvertToCpp<uint64_t>(rt->eval("-1")), v8wrap::Exception);
+        REQUIRE_THROWS_AS(v8wrap::bind::ConvertToCpp<uint64_t>(rt->eval("-1n")), v8wrap::Exception);
+        REQUIRE_THROWS_AS(v8wrap::bind::ConvertToCpp<int64_t>(rt->eval("'1'")), v8wrap::Exception);
+
+        // SafeNumber：安全整数范围内为 Number，超出时为 BigInt
+        using SafeId = Int64<int64_t>;
+        REQUIRE(v8wrap::bind::ConvertToJs(SafeId{maxSafe}).isNumber());
+        REQUIRE(v8wrap::bind::ConvertToJs(SafeId{-maxSafe}).isNumber());
+        REQUIRE(v8wrap::bind::ConvertToJs(SafeId{maxSafe + 1}).isBigInt());
+        REQUIRE(v8wrap::bind::ConvertToJs(Int64<uint64_t>{UINT64_MAX}).isBigInt());
+        REQUIRE(v8wrap::bind::ConvertToCpp<SafeId>(v8wrap::bind::ConvertToJs(SafeId{maxSafe + 1})) == maxSafe + 1);
+
+        // SafeNumberOrThrow：超出时抛出 RangeError
+        using StrictId = Int64<uint64_t, Int64Mode::SafeNumberOrThrow>;
+        REQUIRE(v8wrap::bind::ConvertToJs(StrictId{7}).asNumber().getInt32() == 7);
+        REQUIRE_THROWS_AS(v8wrap::bind::ConvertToJs(StrictId{uint64_t{1} << 53}), v8wrap::Exception);
+
+        // 单个绑定使用 Int64 覆盖默认策略
+        auto next = v8wrap::Function::newFunction([](int64_t id) -> Int64<int64_t> { return id + 1; });
+        rt->getGlobalThis().set("next", next);
+        REQUIRE(rt->eval("typeof next(41)").asString().getValue() == "number");
+        REQUIRE(rt->eval("next(41n) === 42").asBoolean().getValue());
+        REQUIRE(rt->eval("next(2 ** 53 - 1) === 2n ** 53n").asBoolean().getValue());
+        REQUIRE_THROWS_AS(rt->eval("next(0.5)"), v8wrap::Exception);
+
+        // 重载决议：BigInt 策略只匹配 BigInt，Number 策略同时匹配安全整数 Number
+        auto kind = v8wrap::Function::newFunction(
+            [](int64_t) { return std::string{"int64"}; },
+            [](double) { return std::string{"double"}; }
+        );
+        rt->getGlobalThis().set("kind", kind);
+        REQUIRE(rt->eval("kind(42)").asString().getValue() == "double");
+        REQUIRE(rt->eval("kind(1.5)").asString().getValue() == "double");
+        REQUIRE(rt->eval("kind(42n)").asString().getValue() == "int64");
+
+        auto safeKind = v8wrap::Function::newFunction(
+            [](SafeId) { return std::string{"int64"}; },
+            [](double) { return std::string{"double"}; }
+        );
+        rt->getGlobalThis().set("safeKind", safeKind);
+        REQUIRE(rt->eval("safeKind(42)").asString().getValue() == "int64");
+        REQUIRE(rt->eval("safeKind(1.5)").asString().getValue() == "double");
+        REQUIRE(rt->eval("safeKind(42n)").asString().getValue() == "int64");
+    }
+
+    delete rt;
+}
+
+
+struct LazyConfig {
+    std::string      name;
+    std::vector<int> values;
+};
+
+struct CountingInt {
+    int                  value;
+    std::shared_ptr<int> reads;
+};
+
+template <>
+struct v8wrap::bind::TypeConverter<CountingInt> {
+    static v8wrap::Local<v8wrap::Value> toJs(CountingInt const& v) {
+        ++*v.reads;
+        return v8wrap::Number::newNumber(v.value);
+    }
+
+    static CountingInt toCpp(v8wrap::Local<v8wrap::Value> const& v) { return {v.asNumber().getInt32(), nullptr}; }
+};
+
+// 只接受左值的用户转换器，绑定函数按值返回时不应被移动传入
+struct Visited {
+    int value;
+};
+
+template <>
+struct v8wrap::bind::TypeConverter<Visited> {
+    static v8wrap::Local<v8wrap::Value> toJs(Visited& v) { return v8wrap::Number::newNumber(++v.value); }
+
+    static Visited toCpp(v8wrap::Local<v8wrap::Value> const& v) { return {v.asNumber().getInt32()}; }
+};
+
+template <>
+struct v8wrap::bind::StructFields<LazyConfig> {
+    static constexpr auto value =
+        std::make_tuple(V8WRAP_STRUCT_FIELD(LazyConfig, name), V8WRAP_STRUCT_FIELD(LazyConfig, values));
+};
+
+TEST_CASE("TypeConverter lazy view") {
+    auto rt = new v8wrap::Engine();
+
+    {
+        v8wrap::EngineScope scope(rt);
+
+        auto config = v8wrap::bind::ConvertToJs(v8wrap::bind::LazyView{LazyConfig{"cfg", {1, 2, 3}}});
+        rt->getGlobalThis().set("config", config);
+        REQUIRE(rt->eval("config.name").asString().getValue() == "cfg");
+        REQUIRE(rt->eval("config.values.length").asNumber().getInt32() == 3);
+        REQUIRE(rt->eval("config.values === config.values").asBoolean().getValue()); // cached after first read
+        REQUIRE(rt->eval("Object.keys(config).sort().join(',')").asString().getValue() == "name,values");
+
+        auto reads = std::make_shared<int>(0);
+
+        std::unordered_map<std::string, CountingInt> inventory;
+        for (int i = 0; i < 100; ++i) {
+            inventory.emplace("item" + std::to_string(i), CountingInt{i, reads});
+        }
+        auto view = v8wrap::bind::ConvertToJs(v8wrap::bind::LazyView{std::move(inventory)});
+        REQUIRE(*reads == 0);
+
+        rt->getGlobalThis().set("inventory", view);
+        REQUIRE(rt->eval("inventory.item42 + inventory.item42").asNumber().getInt32() == 84);
+        REQUIRE(*reads == 1);
+        REQUIRE(rt->eval("'item7' in inventory").asBoolean().getValue());
+        REQUIRE_FALSE(rt->eval("'missing' in inventory").asBoolean().getValue());
+        REQUIRE(rt->eval("inventory.missing === undefined").asBoolean().getValue());
+        REQUIRE(rt->eval("Object.keys(inventory).length").asNumber().getInt32() == 100);
+        REQUIRE(*reads == 1);
+
+        // 与 Object.prototype 成员同名的键读取到的是容器中的值
+        std::unordered_map<std::string, int> shadowing{{"constructor", 7}, {"toString", 8}, {"__proto__", 9}};
+        rt->getGlobalThis().set("shadowing", v8wrap::bind::ConvertToJs(v8wrap::bind::LazyView{std::move(shadowing)}));
+        REQUIRE(rt->eval("shadowing.constructor").asNumber().getInt32() == 7);
+        REQUIRE(rt->eval("shadowing.toString").asNumber().getInt32() == 8);
+        REQUIRE(rt->eval("shadowing.__proto__").asNumber().getInt32() == 9);
+        REQUIRE(rt->eval("'toString' in shadowing && 'valueOf' in shadowing === false").asBoolean().getValue());
+        REQUIRE(
+            rt->eval("Object.keys(shadowing).sort().join(',')").asString().getValue() == "__proto__,constructor,toString"
+        );
+    }
+
+    delete rt;
+}
+
+TEST_CASE("TypeConverter lvalue-only toJs") {
+    auto rt = new v8wrap::Engine();
+
+    {
+        v8wrap::EngineScope scope(rt);
+
+        rt->getGlobalThis().set("visit", v8wrap::Function::newFunction([](int v) { return Visited{v}; }));
+        REQUIRE(rt->eval("visit(41)").asNumber().getInt32() == 42);
+        REQUIRE(v8wrap::bind::ConvertToJs(Visited{1}).asNumber().getInt32() == 2);
+    }
+
+    delete rt;
+}
+
+TEST_CASE("TypeConverter iterable range") {
+    auto rt = new v8wrap::Engine();
+
+    {
+        v8wrap::EngineScope scope(rt);
+
+        auto produced = std::make_shared<int>(0);
+        auto rows     = std::views::iota(0, 1'000'000) | std::views::transform([produced](int i) {
+                        ++*produced;
+                        return i % 1000;
+                    });
+        rt->getGlobalThis().set("rows", v8wrap::bind::ConvertToJs(v8wrap::bind::Iterable{rows, 64}));
+        REQUIRE(*produced == 0); // nothing is pulled before next()
+
+        auto taken = rt->eval("let n = 0; for (const x of rows) { if (++n === 100) break; } n");
+        REQUIRE(taken.asNumber().getInt32() == 100);
+        REQUIRE(*produced == 128); // two batches
+        auto sum = rt->eval("let sum = 0; for (const x of rows) sum += x; sum"); // resumes after the break
+        REQUIRE(sum.asNumber().getDouble() == 499'500'000.0 - 4'950.0);
+        REQUIRE(*produced == 1'000'000);
+        REQUIRE(rt->eval("rows.next().done").asBoolean().getValue());
+
+        std::vector<std::string> names{"a", "b", "c"};
+        rt->getGlobalThis().set("names", v8wrap::bind::ConvertToJs(v8wrap::bind::Iterable{names}));
+        REQUIRE(rt->eval("[...names].join(',')").asString().getValue() == "a,b,c");
+        REQUIRE(rt->eval("[...names].length").asNumber().getInt32() == 0); // single pass
+
+        REQUIRE_THROWS(rt->eval("rows.next.call({})"));
+    }
+
+    delete rt;
+}
+
+TEST_CASE("TypeConverter async stream") {
+    auto rt = new v8wrap::Engine();
+
+    {
+        v8wrap::EngineScope scope(rt);
+
+        auto pumpUntil = [&](char const* condition) {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (!rt->eval(condition).asBoolean().getValue() && std::chrono::steady_clock::now() < deadline) {
+                rt->runPendingTasks();
+                std::this_thread::yield();
+            }
+            return rt->eval(condition).asBoolean().getValue();
+        };
+
+        SECTION("producer thread with backpressure") {
+            v8wrap::bind::Stream<int> stream{8, 4};
+            rt->getGlobalThis().set("stream", v8wrap::bind::ConvertToJs(stream));
+            rt->eval("globalThis.received = []; globalThis.finished = false;"
+                     "(async () => { for await (const x of stream) received.push(x); finished = true; })();");
+
+            std::thread producer{[stream] {
+                for (int i = 0; i < 1000; ++i) {
+                    (void)stream.push(i); // blocks while 8 items are queued
+                }
+                stream.close();
+            }};
+            REQUIRE(pumpUntil("finished"));
+            producer.join();
+
+            REQUIRE(rt->eval("received.length").asNumber().getInt32() == 1000);
+            REQUIRE(rt->eval("received.every((x, i) => x === i)").asBoolean().getValue());
+        }
+
+        SECTION("tryPush, cancellation and failure") {
+            v8wrap::bind::Stream<std::string> full{2};
+            REQUIRE(full.tryPush("a"));
+            REQUIRE(full.tryPush("b"));
+            REQUIRE_FALSE(full.tryPush("c"));
+
+            rt->getGlobalThis().set("full", v8wrap::bind::ConvertToJs(full));
+            rt->eval("globalThis.first = null; (async () => { for await (const x of full) { first = x; break; } })();");
+            REQUIRE(pumpUntil("first === 'a'"));
+            REQUIRE(full.cancelled());
+            REQUIRE_FALSE(full.push("d"));
+
+            v8wrap::bind::Stream<int> failing;
+            REQUIRE(failing.push(1));
+            failing.fail("disk unplugged");
+            rt->getGlobalThis().set("failing", v8wrap::bind::ConvertToJs(failing));
+            rt->eval("globalThis.error = null; (async () => { try { for await (const x of failing); }"
+                     "catch (e) { error = e.message; } })();");
+            REQUIRE(pumpUntil("error !== null"));
+            REQUIRE(rt->eval("error").asString().getValue() == "disk unplugged");
+        }
+    }
+
+    delete rt;
+}
+
+TEST_CASE("TypeConverter benchmark", "[!benchmark]") {
+    auto rt = new v8wrap::Engine();
+
+    {
+        v8wrap::EngineScope scope(rt);
+
+        std::vector<ReflectedPoint> points(10'000, ReflectedPoint{1, 2.5, "p"});
+        std::vector<double>         numbers(100'000, 0.5);
+
+        auto jsNumbers = v8wrap::bind::ConvertToJs(numbers);
+
+        // 每次迭代在独立的 HandleScope 中创建句柄，避免句柄在外层 scope 中累积
+        BENCHMARK("vector<ReflectedPoint> round trip") {
+            v8::HandleScope handles{rt->isolate()};
+            return v8wrap::bind::ConvertToCpp<std::vector<ReflectedPoint>>(v8wrap::bind::ConvertToJs(points)).size();
+        };
+
+        BENCHMARK("vector<double> to Js") {
+            v8::HandleScope handles{rt->isolate()};
+            return v8wrap::bind::ConvertToJs(numbers).isArray();
+        };
+
+        BENCHMARK("vector<double> to C++") {
+            v8::HandleScope handles{rt->isolate()};
+            return v8wrap::bind::ConvertToCpp<std::vector<double>>(jsNumbers).size();
+        };
+
+        BENCHMARK("Number factory") {
+            v8::HandleScope handles{rt->isolate()};
+
+            double sum = 0;
+            for (int i = 0; i < 100'000; ++i) {
+                sum += v8wrap::Number::newNumber(i).getDouble();
+            }
+            return sum;
+        };
+    }
+
+    delete rt;
+}